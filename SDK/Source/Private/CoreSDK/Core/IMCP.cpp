@@ -1,12 +1,26 @@
 #include "CoreSDK/Core/IMCP.h"
 
+#include <algorithm>
+
+#include "CoreSDK/Messages/MessageContext.h"
+#include "Utilities/Async/ThreadPool.h"
+#include "Utilities/IO/IOReactor.h"
+#include "Utilities/JSON/JSONMessages.h"
+#include "Utilities/JSON/JSONReader.h"
+
 MCP_NAMESPACE_BEGIN
 
 MCPProtocol::MCPProtocol(std::unique_ptr<ITransport> InTransport, const bool InWarnOnDuplicateMessageHandlers)
 	: m_State{ EProtocolState::Uninitialized },
 	  m_Transport{ std::move(InTransport) },
-	  m_MessageManager{ std::make_unique<MessageManager>(InWarnOnDuplicateMessageHandlers) }
+	  m_MessageManager{ std::make_shared<MessageManager>(InWarnOnDuplicateMessageHandlers) },
+	  m_RequestTimers{ std::make_shared<TimerWheel>() }
 {
+	if (m_Transport)
+	{
+		m_RequestTimeout = m_Transport->GetRequestTimeout().value_or(DEFAULT_REQUEST_TIMEOUT);
+	}
+
 	SetupTransportRouter();
 }
 
@@ -32,23 +46,189 @@ void MCPProtocol::ValidateProtocolVersion(const std::string& InVersion)
 void MCPProtocol::SendMCPMessage(const MessageBase& InMessage,
 	const std::optional<std::vector<ConnectionID>>& InConnections) const
 {
+	// Replies go back to the session being served; only broadcast notifications reach every session
+	if (!InConnections)
+	{
+		// Responses to batch elements are sent together once the whole batch has been handled
+		if (BatchCollector* Batch = MessageContext::GetBatch();
+			Batch != nullptr && dynamic_cast<const ResponseBase*>(&InMessage) != nullptr)
+		{
+			JSONData Message;
+			InMessage.SerializeTo(Message);
+			Batch->Add(std::move(Message));
+			return;
+		}
+
+		if (const std::optional<ConnectionID>& Current = MessageContext::GetConnectionID();
+			Current && IsSessionScoped(InMessage))
+		{
+			m_Transport->TransmitMessage(InMessage, std::vector<ConnectionID>{ *Current });
+			return;
+		}
+	}
+
+	// The transport serializes the message itself, straight into its own framing
 	m_Transport->TransmitMessage(InMessage, InConnections);
 }
 
+bool MCPProtocol::IsSessionScoped(const MessageBase& InMessage)
+{
+	// Responses, errors and requests of our own are exchanged with one peer
+	const auto* Notification = dynamic_cast<const NotificationBase*>(&InMessage);
+	if (Notification == nullptr)
+	{
+		return true;
+	}
+
+	// Progress and cancellation refer to a request of the current session
+	return Notification->Method == ProgressNotification::METHOD
+		|| Notification->Method == CancelledNotification::METHOD;
+}
+
+std::optional<EWireFormat> MCPProtocol::SelectWireFormat(
+	const std::optional<ExperimentalCapability>& InPeerCapability) const
+{
+	if (!InPeerCapability || !InPeerCapability->BinaryEncoding)
+	{
+		return std::nullopt;
+	}
+
+	const std::vector<EWireFormat> Supported = m_Transport->GetWireFormats();
+	for (const EWireFormat Format : InPeerCapability->BinaryEncoding->Formats)
+	{
+		if (Format != EWireFormat::JSON && std::ranges::find(Supported, Format) != Supported.end())
+		{
+			return Format;
+		}
+	}
+	return std::nullopt;
+}
+
 void MCPProtocol::InvalidCursor(RequestID InRequestID, const std::string_view InCursor) const
 {
 	SendMCPMessage(ErrorInvalidParams(std::move(InRequestID), "Invalid cursor: " + std::string(InCursor)));
 }
 
-void MCPProtocol::SetupTransportRouter() const
+void MCPProtocol::SetupTransportRouter()
 {
 	if (!m_Transport)
 	{
 		throw std::invalid_argument("Transport cannot be null");
 	}
 
+	// Requests nobody handles are answered with MethodNotFound on the connection they came in on
+	m_MessageManager->SetErrorReplySender(
+		[this](const ErrorResponseBase& InError, const std::optional<ConnectionID>& InConnectionID)
+		{
+			std::optional<std::vector<ConnectionID>> ReplyTo;
+			if (InConnectionID)
+			{
+				ReplyTo.emplace({ *InConnectionID });
+			}
+			m_Transport->TransmitMessage(InError, ReplyTo);
+		});
+
 	// Set up transport handlers
-	m_Transport->SetMessageRouter([this](const JSONData& InMessage) { m_MessageManager->RouteMessage(InMessage); });
+	m_Transport->SetMessageRouter(
+		[this](InboundMessage InMessage, const std::optional<ConnectionID>& InConnectionID)
+		{
+			if (IsBatch(InMessage))
+			{
+				if (IOReactor::IsLoopThread())
+				{
+					// Text borrowed from the reader's buffer is only valid for the duration of this call
+					if (const std::string_view* Borrowed = std::get_if<std::string_view>(&InMessage))
+					{
+						InMessage = std::string(*Borrowed);
+					}
+					Spawn(RouteBatchOnPool(std::move(InMessage), InConnectionID));
+					return;
+				}
+				RouteBatch(std::move(InMessage), InConnectionID);
+				return;
+			}
+			m_MessageManager->RouteMessage(std::move(InMessage), InConnectionID);
+		});
+}
+
+VoidTask MCPProtocol::RouteBatchOnPool(InboundMessage InBatch, const std::optional<ConnectionID> InConnectionID) const
+{
+	co_await ThreadPool::Shared().Schedule();
+	RouteBatch(std::move(InBatch), InConnectionID);
+}
+
+void MCPProtocol::RouteBatch(InboundMessage InBatch, const std::optional<ConnectionID>& InConnectionID) const
+{
+	const auto InvalidRequest = []
+	{
+		return JSONData{ { "jsonrpc", "2.0" },
+			{ "id", nullptr },
+			{ "error", FErrorData{ Errors::InvalidRequest, "Invalid Request" } } };
+	};
+	std::optional<std::vector<ConnectionID>> ReplyTo;
+	if (InConnectionID)
+	{
+		ReplyTo.emplace({ *InConnectionID });
+	}
+
+	// Elements are only split out here; each is decoded by the handler it reaches
+	std::vector<InboundMessage> Elements;
+	try
+	{
+		if (const std::optional<std::string_view> Text = GetMessageText(InBatch))
+		{
+			JSONReader Reader(*Text);
+			Reader.BeginArray();
+			while (Reader.NextElement())
+			{
+				Elements.emplace_back(std::string(Reader.ReadRaw()));
+			}
+			Reader.ExpectEnd();
+		}
+		else
+		{
+			for (JSONData& Element : std::get<JSONData>(InBatch))
+			{
+				Elements.emplace_back(std::move(Element));
+			}
+		}
+	}
+	catch (const std::exception& Except)
+	{
+		HandleRuntimeError("Error parsing batch: " + std::string(Except.what()));
+		return;
+	}
+
+	// An empty batch is answered with a single error, not an empty batch
+	if (Elements.empty())
+	{
+		m_Transport->TransmitMessage(InvalidRequest(), ReplyTo);
+		return;
+	}
+
+	// Elements are independent, so they are handled concurrently; responses are gathered instead of sent
+	BatchCollector Responses;
+	ThreadPool::Shared().ParallelFor(Elements.size(),
+		[this, &Elements, &InConnectionID, &Responses, &InvalidRequest](const std::size_t InIndex)
+		{
+			// Each element is taken by exactly one thread, so it can be moved out of the batch
+			InboundMessage& Element = Elements[InIndex];
+			const MessageEnvelope Envelope = GetEnvelope(Element);
+			if (!Envelope.Type)
+			{
+				Responses.Add(InvalidRequest());
+				return;
+			}
+
+			const MessageContext::BatchScope Batch(&Responses);
+			m_MessageManager->RouteMessage(std::move(Element), Envelope, InConnectionID);
+		});
+
+	// A batch of notifications and responses gets no reply at all
+	if (std::vector<JSONData> Replies = Responses.Take(); !Replies.empty())
+	{
+		m_Transport->TransmitMessage(JSONData(std::move(Replies)), ReplyTo);
+	}
 }
 
 MCP_NAMESPACE_END
\ No newline at end of file
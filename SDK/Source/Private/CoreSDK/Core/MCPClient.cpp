@@ -41,6 +41,8 @@ MCPClient::MCPClient(const ETransportType InTransportType,
 	SetClientCapabilities(InCapabilities);
 }
 
+MCPClient::~MCPClient() { m_Tasks.Join(); }
+
 VoidTask MCPClient::Start()
 {
 	CO_RETURN_VOID_IF_CLIENT_NOT_CONNECTED
@@ -84,7 +86,8 @@ VoidTask MCPClient::Stop()
 	co_return;
 }
 
-OptTask<InitializeResponse::Result> MCPClient::Request_Initialize(const InitializeRequest::Params& InParams)
+OptTask<InitializeResponse::Result> MCPClient::Request_Initialize(const InitializeRequest::Params& InParams,
+	const std::optional<std::chrono::milliseconds> InTimeout)
 {
 	if (IsInitialized())
 	{
@@ -98,12 +101,28 @@ OptTask<InitializeResponse::Result> MCPClient::Request_Initialize(const Initiali
 		// Start transport
 		co_await m_Transport->Connect();
 
-		auto Response = std::move(co_await SendRequest<InitializeResponse>(InitializeRequest{ InParams }));
+		// Offer the binary encodings the transport supports; the server picks at most one
+		InitializeRequest::Params Params = InParams;
+		if (std::vector<EWireFormat> Formats = m_Transport->GetWireFormats(); !Formats.empty())
+		{
+			if (!Params.Capabilities.Experimental)
+			{
+				Params.Capabilities.Experimental.emplace();
+			}
+			Params.Capabilities.Experimental->BinaryEncoding = BinaryEncodingCapability{ std::move(Formats) };
+		}
+
+		auto Response = std::move(co_await SendRequest<InitializeResponse>(InitializeRequest{ Params }, InTimeout));
 		if (Response.Result())
 		{
 			const auto Result = Response.Result().value();
 			// Store negotiated capabilities
 			SetServerCapabilities(Result.Capabilities);
+			// Only switch once the server has confirmed the encoding it will be reading
+			if (const std::optional<EWireFormat> Format = SelectWireFormat(Result.Capabilities.Experimental))
+			{
+				m_Transport->SetWireFormat(Format.value());
+			}
 			SetServerInfo(Result.ServerInfo);
 			SetState(EProtocolState::Initialized);
 			co_return Result;
@@ -17,6 +17,8 @@ MCPServer::MCPServer(const ETransportType InTransportType,
 	SetServerCapabilities(InCapabilities);
 }
 
+MCPServer::~MCPServer() { m_Tasks.Join(); }
+
 VoidTask MCPServer::Start()
 {
 	if (m_IsRunning)
@@ -68,8 +70,26 @@ void MCPServer::OnRequest_Initialize(const InitializeRequest& InRequest)
 	{
 		if (const auto Request = GetRequestParams<InitializeRequest::Params>(InRequest))
 		{
+			// Answer with the one binary encoding picked from the client's offer, if any, so both sides agree on it
+			ServerCapabilities Capabilities = m_ServerCapabilities;
+			const std::optional<EWireFormat> Format = SelectWireFormat(Request.value()->Capabilities.Experimental);
+			if (Format)
+			{
+				if (!Capabilities.Experimental)
+				{
+					Capabilities.Experimental.emplace();
+				}
+				Capabilities.Experimental->BinaryEncoding = BinaryEncodingCapability{ { Format.value() } };
+			}
+
 			SendMCPMessage(InitializeResponse{ InRequest.GetRequestID(),
-				InitializeResponse::Result{ m_ServerInfo.ProtocolVersion, m_ServerInfo, m_ServerCapabilities } });
+				InitializeResponse::Result{ m_ServerInfo.ProtocolVersion, m_ServerInfo, Capabilities } });
+
+			// The response above is still text; everything after it uses the agreed encoding
+			if (Format)
+			{
+				m_Transport->SetWireFormat(Format.value());
+			}
 		}
 	}
 	catch (const std::exception& Except)
@@ -110,11 +130,9 @@ void MCPServer::OnRequest_ListTools(const ListToolsRequest& InRequest)
 {
 	try
 	{
-		const auto RequestParams = GetRequestParams<PaginatedRequestParams>(InRequest);
-
-		const ListToolsResponse::Result Result = m_ToolManager->ListTools(RequestParams.value());
-
-		SendMCPMessage(ListToolsResponse(InRequest.GetRequestID(), Result));
+		// The list is serialized once per change; only the envelope around it is written per request
+		SendMCPMessage(ResponseBase(InRequest.GetRequestID(),
+			std::make_unique<SerializedResultParams>(m_ToolManager->GetSerializedToolList())));
 	}
 	catch (const std::exception& Except)
 	{
@@ -171,11 +189,8 @@ void MCPServer::OnRequest_ListPrompts(const ListPromptsRequest& InRequest)
 {
 	try
 	{
-		const auto RequestParams = GetRequestParams<PaginatedRequestParams>(InRequest);
-
-		const ListPromptsResponse::Result Result = m_PromptManager->ListPrompts(RequestParams.value());
-
-		SendMCPMessage(ListPromptsResponse(InRequest.GetRequestID(), Result));
+		SendMCPMessage(ResponseBase(InRequest.GetRequestID(),
+			std::make_unique<SerializedResultParams>(m_PromptManager->GetSerializedPromptList())));
 	}
 	catch (const std::exception& Except)
 	{
@@ -269,11 +284,8 @@ void MCPServer::OnRequest_ListResources(const ListResourcesRequest& InRequest)
 {
 	try
 	{
-		const auto Request = GetRequestParams<PaginatedRequestParams>(InRequest);
-
-		const ListResourcesResponse::Result Result = m_ResourceManager->ListResources(Request.value());
-
-		SendMCPMessage(ListResourcesResponse(InRequest.GetRequestID(), Result));
+		SendMCPMessage(ResponseBase(InRequest.GetRequestID(),
+			std::make_unique<SerializedResultParams>(m_ResourceManager->GetSerializedResourceList())));
 	}
 	catch (const std::exception& Except)
 	{
@@ -309,7 +321,7 @@ void MCPServer::OnRequest_SubscribeResource(const SubscribeRequest& InRequest)
 	{
 		const auto Request = GetRequestParams<SubscribeRequest::Params>(InRequest).value();
 
-		std::string_view ClientID = GetCurrentClientID();
+		const std::string ClientID = GetCurrentClientID();
 
 		// Validate resource exists
 		if (!m_ResourceManager->HasResource(Request->URI))
@@ -321,7 +333,7 @@ void MCPServer::OnRequest_SubscribeResource(const SubscribeRequest& InRequest)
 		}
 
 		// Add a subscription with proper client tracking
-		m_ResourceManager->AddResourceSubscription(Request, std::string(ClientID));
+		m_ResourceManager->AddResourceSubscription(Request, ClientID);
 
 		// Send an empty response to indicate success
 		SendMCPMessage(EmptyResponse{ InRequest.GetRequestID() });
@@ -337,9 +349,9 @@ void MCPServer::OnRequest_UnsubscribeResource(const UnsubscribeRequest& InReques
 	try
 	{
 		const auto Request = GetRequestParams<UnsubscribeRequest::Params>(InRequest).value();
-		const std::string_view ClientID = GetCurrentClientID();
+		const std::string ClientID = GetCurrentClientID();
 
-		m_ResourceManager->RemoveResourceSubscription(Request, std::string(ClientID));
+		m_ResourceManager->RemoveResourceSubscription(Request, ClientID);
 		SendMCPMessage(EmptyResponse{ InRequest.GetRequestID() });
 	}
 	catch (const std::exception& Except)
@@ -451,22 +463,24 @@ void MCPServer::SetHandlers()
 // Enhanced resource change notification
 void MCPServer::Notify_ResourceSubscribers(const ResourceUpdatedNotification::Params& InParams)
 {
-	// TODO: @HalcyonOmega - Get Actual Subscribers
-
 	if (const auto Subscribers = m_ResourceManager->GetSubscribers(InParams.URI))
 	{
-		// Send notification to all subscribers
+		// Only the sessions that subscribed to this resource
+		if (Subscribers->empty())
+		{
+			return;
+		}
 		SendMCPMessage(ResourceUpdatedNotification{ InParams }, Subscribers.value());
 	}
 }
 
-// Client identification helper (simplified - in production would use transport session data)
-// TODO: @HalcyonOmega - Implement this
-std::string_view MCPServer::GetCurrentClientID() const
+// Session of the request being handled; single-peer transports share one default ID
+std::string MCPServer::GetCurrentClientID() const
 {
-	// For now, return a default client ID
-	// In a real implementation this would extract the client ID from the current
-	// transport session
+	if (const std::optional<ConnectionID>& Current = MessageContext::GetConnectionID())
+	{
+		return *Current;
+	}
 	return "default_client";
 }
 
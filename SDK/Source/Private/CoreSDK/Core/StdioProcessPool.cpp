@@ -0,0 +1,373 @@
+#include "CoreSDK/Core/StdioProcessPool.h"
+
+#include <exception>
+#include <utility>
+
+#include "CoreSDK/Common/RuntimeError.h"
+#include "Utilities/Async/SyncWait.h"
+
+MCP_NAMESPACE_BEGIN
+
+namespace
+{
+	// Errors, timeouts included, arrive as replies too but do not parse as the expected response
+	template <typename Promise> bool IsSuccess(const Promise& InReply)
+	{
+		return InReply.m_RawResponse.contains("result");
+	}
+} // namespace
+
+// StdioProcessLease Implementation
+StdioProcessLease::StdioProcessLease(StdioProcessPool* InPool, std::string InKey, std::shared_ptr<MCPClient> InClient)
+	: m_Pool(InPool),
+	  m_Key(std::move(InKey)),
+	  m_Client(std::move(InClient))
+{}
+
+StdioProcessLease::~StdioProcessLease() { Release(); }
+
+StdioProcessLease::StdioProcessLease(StdioProcessLease&& Other) noexcept
+	: m_Pool(std::exchange(Other.m_Pool, nullptr)),
+	  m_Key(std::move(Other.m_Key)),
+	  m_Client(std::move(Other.m_Client))
+{}
+
+StdioProcessLease& StdioProcessLease::operator=(StdioProcessLease&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Release();
+		m_Pool = std::exchange(Other.m_Pool, nullptr);
+		m_Key = std::move(Other.m_Key);
+		m_Client = std::move(Other.m_Client);
+	}
+	return *this;
+}
+
+void StdioProcessLease::Release()
+{
+	if (m_Pool && m_Client)
+	{
+		m_Pool->Return(m_Key, std::move(m_Client));
+	}
+	m_Pool = nullptr;
+	m_Client.reset();
+}
+
+// StdioProcessPool Implementation
+StdioProcessPool::StdioProcessPool(StdioProcessPoolOptions InOptions) : m_Options(std::move(InOptions))
+{
+	m_MaintenanceThread = std::jthread([this](const std::stop_token& InStopToken) { MaintenanceLoop(InStopToken); });
+}
+
+StdioProcessPool::~StdioProcessPool() noexcept
+{
+	m_MaintenanceThread.request_stop();
+	m_Wake.notify_all();
+	if (m_MaintenanceThread.joinable())
+	{
+		m_MaintenanceThread.join();
+	}
+
+	try
+	{
+		for (auto& [Key, Pool] : m_Pools)
+		{
+			for (std::shared_ptr<MCPClient>& Client : Pool.Idle)
+			{
+				Retire(std::move(Client));
+			}
+		}
+		for (std::shared_ptr<MCPClient>& Client : m_Retiring)
+		{
+			Retire(std::move(Client));
+		}
+	}
+	catch (...)
+	{
+		// Ignore errors during destruction
+	}
+}
+
+void StdioProcessPool::Prewarm(const StdioClientTransportOptions& InServer)
+{
+	{
+		std::lock_guard Lock(m_Mutex);
+		FindOrAddPool(MakeKey(InServer), InServer);
+		m_NeedsMaintenance = true;
+	}
+	m_Wake.notify_one();
+}
+
+StdioProcessLease StdioProcessPool::Acquire(const StdioClientTransportOptions& InServer)
+{
+	std::string Key = MakeKey(InServer);
+	{
+		std::lock_guard Lock(m_Mutex);
+		ServerPool& Pool = FindOrAddPool(Key, InServer);
+		m_NeedsMaintenance = true;
+		m_Wake.notify_one();
+
+		while (!Pool.Idle.empty())
+		{
+			std::shared_ptr<MCPClient> Client = std::move(Pool.Idle.front());
+			Pool.Idle.pop_front();
+
+			// Cheap health check at checkout; the maintenance thread replaces whatever is dropped here
+			if (!Client->IsConnected())
+			{
+				++m_Stats.HealthCheckFailures;
+				m_Retiring.emplace_back(std::move(Client));
+				continue;
+			}
+
+			++m_Stats.Hits;
+			++Pool.InUse;
+			return StdioProcessLease{ this, std::move(Key), std::move(Client) };
+		}
+
+		++m_Stats.Misses;
+	}
+
+	std::shared_ptr<MCPClient> Client = Launch(InServer);
+	if (!Client)
+	{
+		return {};
+	}
+
+	std::lock_guard Lock(m_Mutex);
+	++m_Pools.at(Key).InUse;
+	return StdioProcessLease{ this, std::move(Key), std::move(Client) };
+}
+
+StdioProcessPoolStats StdioProcessPool::GetStats() const
+{
+	std::lock_guard Lock(m_Mutex);
+	StdioProcessPoolStats Stats = m_Stats;
+	for (const auto& [Key, Pool] : m_Pools)
+	{
+		Stats.Idle += Pool.Idle.size();
+		Stats.InUse += Pool.InUse;
+	}
+	return Stats;
+}
+
+std::string StdioProcessPool::MakeKey(const StdioClientTransportOptions& InServer)
+{
+	std::string Key = InServer.Command;
+	for (const std::string& Argument : InServer.Arguments)
+	{
+		Key.push_back('\0');
+		Key.append(Argument);
+	}
+	Key.push_back('\0');
+	Key.push_back(InServer.UseStderr ? '1' : '0');
+	return Key;
+}
+
+StdioProcessPool::ServerPool& StdioProcessPool::FindOrAddPool(const std::string& InKey,
+	const StdioClientTransportOptions& InServer)
+{
+	auto [Iter, IsNew] = m_Pools.try_emplace(InKey);
+	if (IsNew)
+	{
+		Iter->second.Server = InServer;
+	}
+	return Iter->second;
+}
+
+void StdioProcessPool::Return(const std::string& InKey, std::shared_ptr<MCPClient> InClient)
+{
+	{
+		std::lock_guard Lock(m_Mutex);
+		--m_Pools.at(InKey).InUse;
+
+		// Stopped on the maintenance thread, which launches a fresh child in its place
+		++m_Stats.Recycled;
+		m_Retiring.emplace_back(std::move(InClient));
+		m_NeedsMaintenance = true;
+	}
+	m_Wake.notify_one();
+}
+
+std::shared_ptr<MCPClient> StdioProcessPool::Launch(const StdioClientTransportOptions& InServer)
+{
+	try
+	{
+		const std::optional<std::unique_ptr<TransportOptions>> TransportOpts{
+			std::make_unique<StdioClientTransportOptions>(InServer)
+		};
+		auto Client = std::make_shared<MCPClient>(ETransportType::Stdio,
+			TransportOpts,
+			m_Options.ClientInfo,
+			m_Options.Capabilities);
+
+		const InitializeRequest::Params InitParams{
+			m_Options.ClientInfo.ProtocolVersion,
+			m_Options.Capabilities,
+			m_Options.ClientInfo,
+		};
+
+		// The handshake is bounded by its request timeout instead of a deadline here, so the task has always finished
+		// by the time it goes out of scope, even when the child never answers
+		auto Initialize = Client->Request_Initialize(InitParams, m_Options.InitializeTimeout);
+		const bool IsInitialized = SyncWait(Initialize).has_value();
+
+		if (IsInitialized)
+		{
+			std::lock_guard Lock(m_Mutex);
+			++m_Stats.Launched;
+			return Client;
+		}
+
+		HandleRuntimeError("Pooled stdio server failed to initialize: " + InServer.Command);
+		Retire(std::move(Client));
+	}
+	catch (const std::exception& Except)
+	{
+		HandleRuntimeError("Failed to launch pooled stdio server: " + std::string(Except.what()));
+	}
+
+	std::lock_guard Lock(m_Mutex);
+	++m_Stats.LaunchFailures;
+	return nullptr;
+}
+
+void StdioProcessPool::Retire(std::shared_ptr<MCPClient> InClient) const
+{
+	if (!InClient)
+	{
+		return;
+	}
+
+	try
+	{
+		// Stopping only tears the transport down locally, so it is waited out rather than abandoned
+		SyncWait(InClient->Stop());
+	}
+	catch (const std::exception& Except)
+	{
+		HandleRuntimeError("Failed to stop pooled stdio server: " + std::string(Except.what()));
+	}
+}
+
+bool StdioProcessPool::Ping(MCPClient& InClient) const
+{
+	// The request's own timeout guarantees it completes, so it is waited on without a deadline and never dropped while
+	// still in flight
+	auto Ping = InClient.SendRequest<EmptyResponse>(PingRequest{}, m_Options.HealthCheckTimeout);
+	return IsSuccess(SyncWait(Ping));
+}
+
+void StdioProcessPool::Restore(ServerPool& InPool, std::shared_ptr<MCPClient> InClient, const bool InIsHealthy)
+{
+	if (!InIsHealthy)
+	{
+		Retire(std::move(InClient));
+	}
+
+	std::lock_guard Lock(m_Mutex);
+	--InPool.Warming;
+	if (!InIsHealthy)
+	{
+		++m_Stats.HealthCheckFailures;
+		m_NeedsMaintenance = true;
+		return;
+	}
+	InPool.Idle.push_back(std::move(InClient));
+}
+
+void StdioProcessPool::MaintenanceLoop(const std::stop_token& InStopToken)
+{
+	while (!InStopToken.stop_requested())
+	{
+		std::vector<std::shared_ptr<MCPClient>> ToRetire;
+		std::vector<std::pair<ServerPool*, StdioClientTransportOptions>> ToLaunch;
+		std::vector<std::pair<ServerPool*, std::shared_ptr<MCPClient>>> ToPing;
+		{
+			std::unique_lock Lock(m_Mutex);
+			m_Wake.wait_for(Lock, InStopToken, m_Options.HealthCheckInterval, [this] { return m_NeedsMaintenance; });
+			if (InStopToken.stop_requested())
+			{
+				return;
+			}
+			m_NeedsMaintenance = false;
+
+			const auto Now = std::chrono::steady_clock::now();
+			const bool IsHealthCheckDue = Now - m_LastHealthCheck >= m_Options.HealthCheckInterval;
+			if (IsHealthCheckDue)
+			{
+				m_LastHealthCheck = Now;
+			}
+
+			ToRetire.swap(m_Retiring);
+			for (auto& [Key, Pool] : m_Pools)
+			{
+				// Drop idle children whose process has gone away
+				std::erase_if(Pool.Idle,
+					[this, &ToRetire](std::shared_ptr<MCPClient>& InClient)
+					{
+						if (InClient->IsConnected())
+						{
+							return false;
+						}
+						++m_Stats.HealthCheckFailures;
+						ToRetire.emplace_back(std::move(InClient));
+						return true;
+					});
+
+				// Checked children count as warming, so the pool is not topped up behind their backs
+				if (IsHealthCheckDue)
+				{
+					for (std::shared_ptr<MCPClient>& Client : Pool.Idle)
+					{
+						++Pool.Warming;
+						ToPing.emplace_back(&Pool, std::move(Client));
+					}
+					Pool.Idle.clear();
+				}
+
+				while (Pool.Idle.size() + Pool.Warming < m_Options.PoolSize)
+				{
+					++Pool.Warming;
+					ToLaunch.emplace_back(&Pool, Pool.Server);
+				}
+			}
+		}
+
+		for (std::shared_ptr<MCPClient>& Client : ToRetire)
+		{
+			Retire(std::move(Client));
+		}
+
+		// Children start, handshake and answer pings concurrently; joined before the next pass
+		std::vector<std::jthread> Launchers;
+		Launchers.reserve(ToLaunch.size() + ToPing.size());
+		for (auto& [Pool, Client] : ToPing)
+		{
+			Launchers.emplace_back(
+				[this, Pool, Client = std::move(Client)]() mutable
+				{
+					const bool IsHealthy = Ping(*Client);
+					Restore(*Pool, std::move(Client), IsHealthy);
+				});
+		}
+		for (auto& [Pool, Server] : ToLaunch)
+		{
+			Launchers.emplace_back(
+				[this, Pool, Server = std::move(Server)]
+				{
+					std::shared_ptr<MCPClient> Client = Launch(Server);
+
+					std::lock_guard Lock(m_Mutex);
+					--Pool->Warming;
+					if (Client)
+					{
+						Pool->Idle.push_back(std::move(Client));
+					}
+				});
+		}
+	}
+}
+
+MCP_NAMESPACE_END
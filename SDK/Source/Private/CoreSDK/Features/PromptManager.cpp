@@ -26,6 +26,7 @@ bool PromptManager::AddPrompt(const Prompt& InPrompt, const PromptFunction& InFu
 	}
 
 	m_Prompts[InPrompt] = InFunction;
+	m_ListCache.Invalidate();
 	return true;
 }
 
@@ -41,6 +42,7 @@ bool PromptManager::RemovePrompt(const Prompt& InPrompt)
 	}
 
 	m_Prompts.erase(ExistingIt);
+	m_ListCache.Invalidate();
 	return true;
 }
 
@@ -63,6 +65,28 @@ ListPromptsResponse::Result PromptManager::ListPrompts(const PaginatedRequestPar
 {
 	std::lock_guard Lock(m_Mutex);
 
+	ListPromptsResponse::Result Result;
+	Result.Prompts = SnapshotPrompts();
+	// TODO: @HalcyonOmega - Add Cursor support
+	Result.NextCursor = InRequest->Cursor;
+
+	return Result;
+}
+
+SerializedCache::Text PromptManager::GetSerializedPromptList() const
+{
+	std::unique_lock Lock(m_Mutex);
+	return m_ListCache.Get(Lock,
+		[this]
+		{
+			ListPromptsResponse::Result Result;
+			Result.Prompts = SnapshotPrompts();
+			return Result;
+		});
+}
+
+std::vector<Prompt> PromptManager::SnapshotPrompts() const
+{
 	std::vector<Prompt> Prompts;
 	Prompts.reserve(m_Prompts.size());
 
@@ -71,12 +95,7 @@ ListPromptsResponse::Result PromptManager::ListPrompts(const PaginatedRequestPar
 		Prompts.emplace_back(Prompt);
 	}
 
-	ListPromptsResponse::Result Result;
-	Result.Prompts = Prompts;
-	// TODO: @HalcyonOmega - Add Cursor support
-	Result.NextCursor = InRequest->Cursor;
-
-	return Result;
+	return Prompts;
 }
 
 std::optional<Prompt> PromptManager::FindPrompt(const std::string& InName) const
@@ -31,6 +31,7 @@ bool ResourceManager::AddResource(const Resource& InResource)
 	}
 
 	m_Resources[URI] = InResource;
+	m_ListCache.Invalidate();
 	return true;
 }
 
@@ -46,6 +47,7 @@ bool ResourceManager::RemoveResource(const Resource& InResource)
 	}
 
 	m_Resources.erase(ExistingIt);
+	m_ListCache.Invalidate();
 	return true;
 }
 
@@ -133,24 +135,12 @@ std::optional<std::variant<TextResourceContents, BlobResourceContents>> Resource
 
 ListResourcesResponse::Result ResourceManager::ListResources(const PaginatedRequestParams* InRequest)
 {
-	HandleRuntimeError("Listing resources - Count: " + std::to_string(m_Resources.size()));
-
-	std::vector<Resource> Result;
 	std::lock_guard Lock(m_Mutex);
-	Result.reserve(m_Resources.size());
-
-	for (const auto& ResourceData : m_Resources | std::views::values)
-	{
-		Result.push_back(ResourceData);
-	}
-
-	return ListResourcesResponse::Result{ Result, InRequest->Cursor, std::nullopt };
+	return ListResourcesResponse::Result{ SnapshotResources(), InRequest->Cursor, std::nullopt };
 }
 
 ListResourceTemplatesResponse::Result ResourceManager::ListTemplates(const PaginatedRequestParams* InRequest)
 {
-	HandleRuntimeError("Listing templates - Count: " + std::to_string(m_Templates.size()));
-
 	std::vector<ResourceTemplate> Result;
 	std::lock_guard Lock(m_Mutex);
 	Result.reserve(m_Templates.size());
@@ -163,6 +153,13 @@ ListResourceTemplatesResponse::Result ResourceManager::ListTemplates(const Pagin
 	return ListResourceTemplatesResponse::Result{ Result, InRequest->Cursor, std::nullopt };
 }
 
+SerializedCache::Text ResourceManager::GetSerializedResourceList() const
+{
+	std::unique_lock Lock(m_Mutex);
+	return m_ListCache.Get(Lock,
+		[this] { return ListResourcesResponse::Result{ SnapshotResources(), std::nullopt, std::nullopt }; });
+}
+
 bool ResourceManager::HasResource(const MCP::URI& InURI) const
 {
 	std::lock_guard Lock(m_Mutex);
@@ -177,7 +174,10 @@ bool ResourceManager::AddResourceSubscription(const SubscribeRequest::Params* In
 	if (const auto Iterator = m_ResourceSubscriptions.find(InResource->URI.toString());
 		Iterator != m_ResourceSubscriptions.end())
 	{
-		Iterator->second.emplace_back(InConnection);
+		if (std::ranges::find(Iterator->second, InConnection) == Iterator->second.end())
+		{
+			Iterator->second.emplace_back(InConnection);
+		}
 		return true;
 	}
 	std::vector<std::string> Connections{ InConnection };
@@ -193,8 +193,7 @@ bool ResourceManager::RemoveResourceSubscription(const UnsubscribeRequest::Param
 	if (const auto Iterator = m_ResourceSubscriptions.find(InResource->URI.toString());
 		Iterator != m_ResourceSubscriptions.end())
 	{
-		Iterator->second.erase(std::ranges::remove(Iterator->second, InConnection).begin());
-		return true;
+		return std::erase(Iterator->second, InConnection) > 0;
 	}
 	return false;
 }
@@ -211,6 +210,19 @@ std::optional<std::vector<std::string>> ResourceManager::GetSubscribers(const MC
 	return std::nullopt;
 }
 
+std::vector<Resource> ResourceManager::SnapshotResources() const
+{
+	std::vector<Resource> Result;
+	Result.reserve(m_Resources.size());
+
+	for (const auto& ResourceData : m_Resources | std::views::values)
+	{
+		Result.push_back(ResourceData);
+	}
+
+	return Result;
+}
+
 std::optional<std::unordered_map<std::string, std::string>>
 ResourceManager::MatchTemplate(const ResourceTemplate& InTemplate, const MCP::URI& InURI)
 {
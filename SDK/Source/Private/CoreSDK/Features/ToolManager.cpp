@@ -23,6 +23,17 @@ ListToolsResponse::Result ToolManager::ListTools(const PaginatedRequestParams* I
 	std::lock_guard Lock(m_Mutex);
 	(void)InRequest; // TODO: @HalcyonOmega - Implement pagination
 
+	return ListToolsResponse::Result{ SnapshotTools() };
+}
+
+SerializedCache::Text ToolManager::GetSerializedToolList() const
+{
+	std::unique_lock Lock(m_Mutex);
+	return m_ListCache.Get(Lock, [this] { return ListToolsResponse::Result{ SnapshotTools() }; });
+}
+
+std::vector<Tool> ToolManager::SnapshotTools() const
+{
 	std::vector<Tool> Result;
 	Result.reserve(m_Tools.size());
 
@@ -31,7 +42,7 @@ ListToolsResponse::Result ToolManager::ListTools(const PaginatedRequestParams* I
 		Result.emplace_back(ToolItem);
 	}
 
-	return ListToolsResponse::Result{ Result };
+	return Result;
 }
 
 bool ToolManager::AddTool(const Tool& InTool, const ToolFunction& InFunction)
@@ -49,6 +60,7 @@ bool ToolManager::AddTool(const Tool& InTool, const ToolFunction& InFunction)
 	}
 
 	m_Tools.emplace(InTool, InFunction);
+	m_ListCache.Invalidate();
 	return true;
 }
 
@@ -64,6 +76,7 @@ bool ToolManager::RemoveTool(const Tool& InTool)
 	}
 
 	m_Tools.erase(ExistingIt);
+	m_ListCache.Invalidate();
 	return true;
 }
 
@@ -3,20 +3,187 @@
 #include <Poco/Net/HTTPMessage.h>
 #include <Poco/Net/HTTPRequest.h>
 #include <Poco/Net/HTTPResponse.h>
+#include <Poco/Net/HTTPServerRequestImpl.h>
 #include <Poco/StreamCopier.h>
 #include <Poco/URI.h>
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
+#include "CoreSDK/Common/Logging.h"
 #include "CoreSDK/Common/RuntimeError.h"
+#include "CoreSDK/Messages/ErrorResponseBase.h"
 #include "CoreSDK/Messages/MCPMessages.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerResponse.h"
+#include "UUIDProxy.h"
+#include "Utilities/Async/SyncWait.h"
 #include "Utilities/JSON/JSONMessages.h"
+#include "Utilities/JSON/JSONReader.h"
 
 MCP_NAMESPACE_BEGIN
 
-HTTPTransportClient::HTTPTransportClient(HTTPTransportOptions InOptions) : ITransport(), m_Options(std::move(InOptions))
+namespace
+{
+	// Streamable HTTP session header, assigned by the server on initialize and echoed by the client afterwards
+	constexpr auto SESSION_HEADER = "Mcp-Session-Id";
+
+	// Request IDs and progress tokens are matched by value; a string and a number with the same text are the same key
+	std::string MakeExchangeKey(const std::string_view InSessionID, const std::string_view InID)
+	{
+		std::string Key{ InSessionID };
+		Key.push_back('\n');
+		Key.append(InID);
+		return Key;
+	}
+
+	// Whether a reply to the request may be upgraded to an event stream
+	bool AcceptsEventStream(const Poco::Net::HTTPServerRequest& InRequest)
+	{
+		return InRequest.get("Accept", "").find("text/event-stream") != std::string::npos;
+	}
+
+	// The text an ID or token is keyed by: a string's value or a number's digits
+	std::string ExchangeKeyText(const JSONData& InID)
+	{
+		return InID.is_string() ? InID.get<std::string>() : InID.dump();
+	}
+
+	// The progress token a request asks for in params._meta, in the same form as an exchange key. Every other member
+	// is stepped over without being decoded.
+	std::optional<std::string> ScanProgressToken(const std::string_view InRequest)
+	{
+		const auto FindMember = [](JSONReader& InReader, const std::string_view InKey)
+		{
+			if (InReader.Peek() != JSONReader::EValueType::Object)
+			{
+				return false;
+			}
+			InReader.BeginObject();
+			while (const std::optional<std::string_view> Key = InReader.NextKey())
+			{
+				if (Key.value() == InKey)
+				{
+					return true;
+				}
+				InReader.Skip();
+			}
+			return false;
+		};
+
+		JSONReader Reader(InRequest);
+		if (!FindMember(Reader, "params") || !FindMember(Reader, "_meta") || !FindMember(Reader, "progressToken"))
+		{
+			return std::nullopt;
+		}
+		if (Reader.Peek() == JSONReader::EValueType::String)
+		{
+			return Reader.ReadString();
+		}
+		return std::string(Reader.ReadRaw());
+	}
+} // namespace
+
+// HTTPClientSessionPool Implementation
+HTTPClientSessionPool::HTTPClientSessionPool(const HTTPTransportOptions& InOptions) : m_Options(InOptions) {}
+
+HTTPClientSessionPool::PooledSession HTTPClientSessionPool::Acquire()
+{
+	std::vector<PooledSession> Expired;
+	PooledSession Result;
+	{
+		std::unique_lock Lock(m_Mutex);
+		while (true)
+		{
+			const auto Now = std::chrono::steady_clock::now();
+			while (!m_Idle.empty())
+			{
+				PooledSession Candidate = std::move(m_Idle.back());
+				m_Idle.pop_back();
+				if (Now - Candidate.LastUsed < m_Options.IdleTimeout)
+				{
+					Result = std::move(Candidate);
+					break;
+				}
+				--m_OpenCount;
+				Expired.emplace_back(std::move(Candidate));
+			}
+			if (Result.Session)
+			{
+				break;
+			}
+
+			if (m_OpenCount < std::max<std::size_t>(m_Options.MaxConnections, 1))
+			{
+				++m_OpenCount;
+				Result.Generation = m_Generation;
+				break;
+			}
+			m_Available.wait(Lock);
+		}
+	}
+
+	// Expired sessions are closed and new ones configured outside the lock
+	Expired.clear();
+	if (!Result.Session)
+	{
+		try
+		{
+			Result.Session = std::make_unique<Poco::Net::HTTPClientSession>(m_Options.Host, m_Options.Port);
+			Result.Session->setTimeout(m_Options.ConnectTimeout);
+			Result.Session->setKeepAlive(true);
+			Result.Session->setKeepAliveTimeout(m_Options.IdleTimeout);
+		}
+		catch (...)
+		{
+			{
+				std::lock_guard Lock(m_Mutex);
+				--m_OpenCount;
+			}
+			m_Available.notify_one();
+			throw;
+		}
+	}
+	return Result;
+}
+
+void HTTPClientSessionPool::Release(PooledSession InSession, const bool InIsReusable)
+{
+	{
+		std::lock_guard Lock(m_Mutex);
+		++InSession.RequestCount;
+		if (InIsReusable && InSession.Generation == m_Generation
+			&& InSession.RequestCount < m_Options.MaxRequestsPerConnection)
+		{
+			InSession.LastUsed = std::chrono::steady_clock::now();
+			m_Idle.emplace_back(std::move(InSession));
+		}
+		else
+		{
+			--m_OpenCount;
+		}
+	}
+	m_Available.notify_one();
+}
+
+void HTTPClientSessionPool::Clear()
+{
+	std::vector<PooledSession> Closing;
+	{
+		std::lock_guard Lock(m_Mutex);
+		m_OpenCount -= m_Idle.size();
+		Closing.swap(m_Idle);
+		++m_Generation;
+	}
+	m_Available.notify_all();
+}
+
+// HTTPTransportClient Implementation
+HTTPTransportClient::HTTPTransportClient(HTTPTransportOptions InOptions)
+	: ITransport(),
+	  m_Options(std::move(InOptions)),
+	  m_SessionPool(m_Options)
 {}
 
 HTTPTransportClient::~HTTPTransportClient() noexcept
@@ -25,7 +192,7 @@ HTTPTransportClient::~HTTPTransportClient() noexcept
 	{
 		try
 		{
-			HTTPTransportClient::Disconnect().await_resume();
+			SyncWait(HTTPTransportClient::Disconnect());
 		}
 		catch (...)
 		{
@@ -71,12 +238,25 @@ VoidTask HTTPTransportClient::Disconnect()
 	{
 		m_ShouldStop = true;
 
-		// Stop SSE thread
-		if (m_SSEThread.joinable())
+		// The stream's read only returns once the server sends something, so its connection is cut instead
 		{
-			m_SSEThread.join();
+			std::lock_guard Lock(m_SSEMutex);
+			if (m_SSESession)
+			{
+				m_SSESession->abort();
+			}
+		}
+		std::jthread SSEThread;
+		{
+			std::lock_guard Lock(m_SessionIDMutex);
+			SSEThread = std::move(m_SSEThread);
+		}
+		if (SSEThread.joinable())
+		{
+			SSEThread.join();
 		}
 
+		TerminateSession();
 		Cleanup();
 		SetState(ETransportState::Disconnected);
 	}
@@ -99,33 +279,33 @@ void HTTPTransportClient::run() { StartSSEConnection(); }
 
 VoidTask HTTPTransportClient::ConnectToServer()
 {
+	// Test connection with a ping, leaving the connection open in the pool
+	HTTPClientSessionPool::PooledSession Connection;
 	try
 	{
-		std::lock_guard lock(m_ConnectionMutex);
-
-		// Create an HTTP session
-		m_HTTPSession = std::make_unique<Poco::Net::HTTPClientSession>(m_Options.Host, m_Options.Port);
-		m_HTTPSession->setTimeout(m_Options.ConnectTimeout);
+		Connection = m_SessionPool.Acquire();
 
-		// Test connection with a ping
 		Poco::Net::HTTPRequest Request(Poco::Net::HTTPRequest::HTTP_POST,
 			m_Options.Path,
 			Poco::Net::HTTPMessage::HTTP_1_1);
 		Request.setContentType("application/json");
 		Request.set("Accept", "text/event-stream");
 
-		const JSONData PingMessage = PingRequest{};
+		// Sent before any protocol layer numbers requests, so it carries its own ID
+		PingRequest Ping;
+		Ping.ID = RequestID{ "connect-" + GenerateUUID() };
 
-		const std::string Body = PingMessage.dump();
+		std::string Body;
+		WriteFramedMessage(Ping, Body);
 		Request.setContentLength(static_cast<std::streamsize>(Body.length()));
 
-		std::ostream& RequestStream = m_HTTPSession->sendRequest(Request);
+		std::ostream& RequestStream = Connection.Session->sendRequest(Request);
 		RequestStream << Body;
 
 		Poco::Net::HTTPResponse Response;
-		const std::istream& ResponseStream = m_HTTPSession->receiveResponse(Response);
-
-		(void)ResponseStream;
+		std::istream& ResponseStream = Connection.Session->receiveResponse(Response);
+		ResponseStream.ignore(std::numeric_limits<std::streamsize>::max());
+		m_SessionPool.Release(std::move(Connection), Response.getKeepAlive() && !ResponseStream.bad());
 
 		if (Response.getStatus() != Poco::Net::HTTPResponse::HTTP_OK)
 		{
@@ -133,13 +313,15 @@ VoidTask HTTPTransportClient::ConnectToServer()
 			co_return;
 		}
 
-		// Start SSE connection for real-time communication
+		// The event stream is opened once initialize has been answered with a session ID
 		m_ShouldStop = false;
-		// TODO: @HalcyonOmega This should start automatically
-		// m_SSEThread.start(*this);
 	}
 	catch (const std::exception& e)
 	{
+		if (Connection.Session)
+		{
+			m_SessionPool.Release(std::move(Connection), false);
+		}
 		HandleRuntimeError("Failed to connect to HTTP server: " + std::string(e.what()));
 		co_return;
 	}
@@ -151,34 +333,95 @@ void HTTPTransportClient::TransmitMessage(const JSONData& InMessage,
 	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
 {
 	(void)InConnectionIDs;
+	PostBody(InMessage.dump());
+}
 
-	if (!m_HTTPSession)
+void HTTPTransportClient::TransmitMessage(const MessageBase& InMessage,
+	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
+{
+	(void)InConnectionIDs;
+
+	// The body is only read while the request is sent, so each sending thread can keep reusing one buffer
+	thread_local std::string Body;
+	WriteFramedMessage(InMessage, Body);
+	PostBody(Body);
+}
+
+void HTTPTransportClient::PostBody(const std::string_view InBody)
+{
+	if (GetState() == ETransportState::Disconnected)
 	{
 		HandleRuntimeError("HTTP session not initialized");
 		return;
 	}
 
+	// Each message holds one pooled connection for its round trip only, so concurrent sends run in parallel
+	HTTPClientSessionPool::PooledSession Connection;
+	bool IsReusable{ false };
+	// Routed once the connection is back in the pool: handling a response may send the next request
+	std::vector<std::string> Replies;
 	try
 	{
-		std::lock_guard Lock(m_ConnectionMutex);
+		Connection = m_SessionPool.Acquire();
 
 		Poco::Net::HTTPRequest Request(Poco::Net::HTTPRequest::HTTP_POST,
 			m_Options.Path,
 			Poco::Net::HTTPMessage::HTTP_1_1);
 		Request.setContentType("application/json");
+		Request.set("Accept", "application/json, text/event-stream");
 		Request.set("MCP-Protocol-Version", ToString(m_Options.ProtocolVersion));
+		ApplySessionHeader(Request);
 
-		const std::string Body = InMessage.dump();
-		Request.setContentLength(static_cast<std::streamsize>(Body.length()));
+		Request.setContentLength(static_cast<std::streamsize>(InBody.length()));
 
-		std::ostream& RequestStream = m_HTTPSession->sendRequest(Request);
-		RequestStream << Body;
+		std::ostream& RequestStream = Connection.Session->sendRequest(Request);
+		RequestStream << InBody;
 
 		Poco::Net::HTTPResponse Response;
-		const std::istream& ResponseStream = m_HTTPSession->receiveResponse(Response);
-		(void)ResponseStream;
+		std::istream& ResponseStream = Connection.Session->receiveResponse(Response);
+		CaptureSessionHeader(Response);
 
-		if (Response.getStatus() != Poco::Net::HTTPResponse::HTTP_OK)
+		// A request is answered on the POST itself, either directly or as a stream carrying its progress first
+		if (Response.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
+		{
+			if (Response.getContentType().starts_with("text/event-stream"))
+			{
+				std::string Line;
+				while (std::getline(ResponseStream, Line))
+				{
+					if (!Line.starts_with("data: "))
+					{
+						continue;
+					}
+					std::string Message = Line.substr(6);
+					if (const std::optional<EMessageType> Type = ScanEnvelope(Message).Type;
+						Type == EMessageType::Request || Type == EMessageType::Notification)
+					{
+						CallMessageRouter(std::move(Message));
+					}
+					else
+					{
+						Replies.emplace_back(std::move(Message));
+					}
+				}
+			}
+			else
+			{
+				std::string ResponseBody;
+				Poco::StreamCopier::copyToString(ResponseStream, ResponseBody);
+				if (IsBatchText(ResponseBody) || ScanEnvelope(ResponseBody).IsValid())
+				{
+					Replies.emplace_back(std::move(ResponseBody));
+				}
+			}
+		}
+
+		// The body must be consumed before the connection can carry another request
+		ResponseStream.ignore(std::numeric_limits<std::streamsize>::max());
+		IsReusable = Response.getKeepAlive() && !ResponseStream.bad();
+
+		if (Response.getStatus() != Poco::Net::HTTPResponse::HTTP_OK
+			&& Response.getStatus() != Poco::Net::HTTPResponse::HTTP_ACCEPTED)
 		{
 			HandleRuntimeError("HTTP request failed: " + Response.getReason());
 		}
@@ -187,26 +430,48 @@ void HTTPTransportClient::TransmitMessage(const JSONData& InMessage,
 	{
 		HandleRuntimeError("Error sending HTTP message: " + std::string(Except.what()));
 	}
+
+	if (Connection.Session)
+	{
+		m_SessionPool.Release(std::move(Connection), IsReusable);
+	}
+
+	for (std::string& Reply : Replies)
+	{
+		CallMessageRouter(std::move(Reply));
+	}
 }
 
 void HTTPTransportClient::StartSSEConnection()
 {
 	try
 	{
-		// Create a separate session for SSE
-		const auto SSESession = std::make_unique<Poco::Net::HTTPClientSession>(m_Options.Host, m_Options.Port);
+		// A connection of its own, held open for as long as the transport is connected
+		Poco::Net::HTTPClientSession* SSESession{ nullptr };
+		{
+			std::lock_guard Lock(m_SSEMutex);
+			if (m_ShouldStop)
+			{
+				return;
+			}
+			m_SSESession = std::make_unique<Poco::Net::HTTPClientSession>(m_Options.Host, m_Options.Port);
+			SSESession = m_SSESession.get();
+		}
+		// The stream is idle between events, so reads wait without a timeout until Disconnect aborts them
+		SSESession->setTimeout(m_Options.ConnectTimeout, m_Options.ConnectTimeout, Poco::Timespan{ 0 });
 
 		Poco::Net::HTTPRequest Request(Poco::Net::HTTPRequest::HTTP_GET,
 			m_Options.Path + "/events",
 			Poco::Net::HTTPMessage::HTTP_1_1);
 		Request.set("Accept", "text/event-stream");
 		Request.set("Cache-Control", "no-cache");
+		ApplySessionHeader(Request);
 
 		const std::ostream& RequestStream = SSESession->sendRequest(Request);
 		(void)RequestStream;
 
 		Poco::Net::HTTPResponse Response;
-		m_SSEStream = std::unique_ptr<std::istream>(&SSESession->receiveResponse(Response));
+		std::istream& SSEStream = SSESession->receiveResponse(Response);
 
 		if (Response.getStatus() != Poco::Net::HTTPResponse::HTTP_OK)
 		{
@@ -216,7 +481,7 @@ void HTTPTransportClient::StartSSEConnection()
 
 		// Process SSE events
 		std::string Line;
-		while (!m_ShouldStop && std::getline(*m_SSEStream, Line))
+		while (!m_ShouldStop && std::getline(SSEStream, Line))
 		{
 			if (!Line.empty())
 			{
@@ -240,15 +505,19 @@ void HTTPTransportClient::ProcessSSELine(const std::string& InLine)
 		// SSE format: "data: <json>\n"
 		if (InLine.substr(0, 6) == "data: ")
 		{
-			std::string JSONData = InLine.substr(6);
-			const auto Message = JSONData::parse(JSONData);
+			std::string Message = InLine.substr(6);
+			// The server opens every stream with a greeting of its own
+			if (Message.starts_with(R"({"type":"connection_established")"))
+			{
+				return;
+			}
 
-			if (!IsValidJSONRPC(Message))
+			if (!IsBatchText(Message) && !ScanEnvelope(Message).IsValid())
 			{
 				HandleRuntimeError("Invalid JSON-RPC message received via SSE");
 				return;
 			}
-			CallMessageRouter(Message);
+			CallMessageRouter(std::move(Message));
 		}
 	}
 	catch (const std::exception& Except)
@@ -257,10 +526,73 @@ void HTTPTransportClient::ProcessSSELine(const std::string& InLine)
 	}
 }
 
+void HTTPTransportClient::ApplySessionHeader(Poco::Net::HTTPRequest& InRequest) const
+{
+	std::lock_guard Lock(m_SessionIDMutex);
+	if (!m_SessionID.empty())
+	{
+		InRequest.set(SESSION_HEADER, m_SessionID);
+	}
+}
+
+void HTTPTransportClient::CaptureSessionHeader(const Poco::Net::HTTPResponse& InResponse)
+{
+	if (InResponse.has(SESSION_HEADER))
+	{
+		std::lock_guard Lock(m_SessionIDMutex);
+		m_SessionID = InResponse.get(SESSION_HEADER);
+		if (!m_SSEThread.joinable() && !m_ShouldStop)
+		{
+			m_SSEThread = std::jthread([this] { run(); });
+		}
+	}
+}
+
+void HTTPTransportClient::TerminateSession()
+{
+	std::string SessionID;
+	{
+		std::lock_guard Lock(m_SessionIDMutex);
+		SessionID = std::exchange(m_SessionID, {});
+	}
+	if (SessionID.empty())
+	{
+		return;
+	}
+
+	// Best effort: the server also drops sessions when it restarts
+	HTTPClientSessionPool::PooledSession Connection;
+	try
+	{
+		Connection = m_SessionPool.Acquire();
+
+		Poco::Net::HTTPRequest Request(Poco::Net::HTTPRequest::HTTP_DELETE,
+			m_Options.Path,
+			Poco::Net::HTTPMessage::HTTP_1_1);
+		Request.set(SESSION_HEADER, SessionID);
+		Connection.Session->sendRequest(Request);
+
+		Poco::Net::HTTPResponse Response;
+		Connection.Session->receiveResponse(Response).ignore(std::numeric_limits<std::streamsize>::max());
+	}
+	catch (const std::exception& Except)
+	{
+		HandleRuntimeError("Failed to terminate HTTP session: " + std::string(Except.what()));
+	}
+
+	if (Connection.Session)
+	{
+		m_SessionPool.Release(std::move(Connection), false);
+	}
+}
+
 void HTTPTransportClient::Cleanup()
 {
-	m_SSEStream.reset();
-	m_HTTPSession.reset();
+	{
+		std::lock_guard Lock(m_SSEMutex);
+		m_SSESession.reset();
+	}
+	m_SessionPool.Clear();
 }
 
 // MCPHTTPRequestHandler Implementation
@@ -299,8 +631,21 @@ Poco::Net::HTTPRequestHandler* MCPHTTPRequestHandlerFactory::createRequestHandle
 }
 
 // HTTPTransportServer Implementation
-HTTPTransportServer::HTTPTransportServer(HTTPTransportOptions InOptions) : m_Options(std::move(InOptions))
+HTTPTransportServer::HTTPTransportServer(HTTPTransportOptions InOptions)
+	: m_Options(std::move(InOptions)),
+	  m_SSEEngine(m_Options.MaxQueuedEventsPerStream, m_Options.MaxQueuedBytesPerStream, m_Options.SlowConsumerPolicy)
 {
+	// A stream given up on has lost messages its session was owed, so the session ends with it and the client has to
+	// initialize again. A peer that merely went away may still reconnect its stream to the same session.
+	m_SSEEngine.SetDisconnectCallback(
+		[this](const std::string& InClientID, const ESSECloseReason InReason)
+		{
+			if (InReason == ESSECloseReason::SlowConsumer && IsConnectionRegistered(InClientID))
+			{
+				Logger::Warning("Closed session that fell behind on its stream: " + InClientID);
+				UnregisterConnection(InClientID);
+			}
+		});
 	SetState(ETransportState::Disconnected);
 }
 
@@ -310,7 +655,7 @@ HTTPTransportServer::~HTTPTransportServer()
 	{
 		try
 		{
-			HTTPTransportServer::Disconnect().await_resume();
+			SyncWait(HTTPTransportServer::Disconnect());
 		}
 		catch (...)
 		{
@@ -324,6 +669,7 @@ VoidTask HTTPTransportServer::Connect()
 	if (GetState() != ETransportState::Disconnected)
 	{
 		HandleRuntimeError("Transport already started");
+		co_return;
 	}
 
 	try
@@ -332,8 +678,9 @@ VoidTask HTTPTransportServer::Connect()
 
 		m_ServerSocket = std::make_unique<Poco::Net::ServerSocket>(m_Options.Port);
 		const auto& Params = new Poco::Net::HTTPServerParams();
-		m_HTTPServer
-			= std::make_unique<Poco::Net::HTTPServer>(new MCPHTTPRequestHandlerFactory(), *m_ServerSocket, Params);
+		auto* Factory = new MCPHTTPRequestHandlerFactory();
+		Factory->SetServer(this);
+		m_HTTPServer = std::make_unique<Poco::Net::HTTPServer>(Factory, *m_ServerSocket, Params);
 
 		m_HTTPServer->start();
 		SetState(ETransportState::Connected);
@@ -361,14 +708,11 @@ VoidTask HTTPTransportServer::Disconnect()
 			m_HTTPServer->stop();
 		}
 
-		// Close all SSE clients
+		// Close all SSE clients; sessions do not survive a restart
+		m_SSEEngine.CloseAll();
+		for (const ConnectionID& SessionID : GetActiveConnections())
 		{
-			std::lock_guard Lock(m_ClientsMutex);
-			for (const auto& client : m_SSEClients | std::views::values)
-			{
-				client->IsActive = false;
-			}
-			m_SSEClients.clear();
+			UnregisterConnection(SessionID);
 		}
 
 		m_HTTPServer.reset();
@@ -403,88 +747,100 @@ void HTTPTransportServer::HandleHTTPRequest(Poco::Net::HTTPServerRequest& InRequ
 		if (const std::string Method = InRequest.getMethod(); Path == "/message" && Method == "GET")
 		{
 			// MCP StreamableHTTP GET endpoint implementation
-			InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
-			InResponse.setContentType("text/event-stream");
-			InResponse.set("Cache-Control", "no-cache");
-			InResponse.set("Connection", "keep-alive");
-			InResponse.set("Access-Control-Allow-Origin", "*");
-			InResponse.set("Access-Control-Allow-Headers", "Content-Type");
-			InResponse.set("Access-Control-Allow-Methods", "GET, POST, OPTIONS");
-
-			const std::string ClientID = GenerateUUID();
-			RegisterSSEClient(ClientID, InResponse);
-
-			// Send initial connection event
-			std::ostream& ResponseStream = InResponse.send();
-			ResponseStream << R"(data: {"type":"connection_established","clientId":")" << ClientID << "\"}\n\n";
-			ResponseStream.flush();
-
-			// Keep the connection alive until the client disconnects
-			while (true)
-			{
-				{
-					std::lock_guard Lock(m_ClientsMutex);
-
-					if (auto Iter = m_SSEClients.find(ClientID); Iter == m_SSEClients.end() || !Iter->second->IsActive)
-					{
-						break;
-					}
-				}
-				std::this_thread::sleep_for(std::chrono::milliseconds(100));
-			}
+			InResponse.set("Access-Control-Allow-Headers", "Content-Type, Mcp-Session-Id");
+			InResponse.set("Access-Control-Allow-Methods", "GET, POST, DELETE, OPTIONS");
+			(void)OpenEventStream(InRequest, InResponse, true);
 		}
 		else if (Path == m_Options.Path + "/events")
 		{
 			// Legacy SSE endpoint (kept for backwards compatibility)
-			InResponse.setContentType("text/event-stream");
-			InResponse.set("Cache-Control", "no-cache");
-			InResponse.set("Connection", "keep-alive");
-			InResponse.set("Access-Control-Allow-Origin", "*");
-
-			const std::string ClientID = GenerateUUID();
-			RegisterSSEClient(ClientID, InResponse);
-
-			// Keep connection alive
-			std::ostream& ResponseStream = InResponse.send();
-			ResponseStream << "data: {\"type\":\"connection_established\"}\n\n";
-			ResponseStream.flush();
+			(void)OpenEventStream(InRequest, InResponse, false);
+		}
+		else if (Path == m_Options.Path && Method == "POST")
+		{
+			// JSON-RPC endpoint
+			std::istream& requestStream = InRequest.stream();
+			std::string body;
+			Poco::StreamCopier::copyToString(requestStream, body);
 
-			// Wait until the client disconnects
-			while (true)
+			// Initialize opens a session; everything after it has to name a session this server issued. Only the
+			// envelope is read here, so a missing or unknown session is turned away without decoding the body.
+			ConnectionID SessionID;
+			if (InRequest.has(SESSION_HEADER))
 			{
-				std::lock_guard Lock(m_ClientsMutex);
-
-				if (auto Iterator = m_SSEClients.find(ClientID);
-					Iterator == m_SSEClients.end() || !Iterator->second->IsActive)
+				SessionID = InRequest.get(SESSION_HEADER);
+				if (!IsConnectionRegistered(SessionID))
 				{
-					break;
+					SendSessionNotFound(InResponse);
+					return;
 				}
-				std::this_thread::sleep_for(std::chrono::milliseconds(100));
 			}
-		}
-		else if (Path == m_Options.Path && Method == "POST")
-		{
-			// JSON-RPC endpoint
+			else if (!IsBatchText(body) && ScanEnvelope(body).Method == InitializeRequest::METHOD)
+			{
+				SessionID = GenerateUUID();
+				RegisterConnection(SessionID);
+			}
+			else
+			{
+				InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+				InResponse.setReason("Missing Session ID");
+				InResponse.set("Access-Control-Allow-Origin", "*");
+				InResponse.send() << "400 Missing " << SESSION_HEADER << " header\n";
+				return;
+			}
+
 			InResponse.setContentType("application/json");
 			InResponse.set("Access-Control-Allow-Origin", "*");
+			InResponse.set("Access-Control-Expose-Headers", SESSION_HEADER);
+			InResponse.set(SESSION_HEADER, SessionID);
+
+			// Only requests get an answer on the POST; notifications and responses are just accepted
+			std::optional<RequestID> DuplicateID;
+			const std::shared_ptr<PostExchange> Exchange
+				= OpenExchange(SessionID, body, AcceptsEventStream(InRequest), DuplicateID);
+			if (DuplicateID)
+			{
+				// Its answer could not be told apart from the one already owed, so the message is not processed
+				std::string Error;
+				WriteFramedMessage(ErrorInvalidRequest(*DuplicateID, "Request ID is already in use"), Error);
+				InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_BAD_REQUEST);
+				InResponse.setContentLength(static_cast<std::streamsize>(Error.size()));
+				InResponse.send() << Error;
+				return;
+			}
 
-			std::istream& requestStream = InRequest.stream();
-			std::string body;
-			Poco::StreamCopier::copyToString(requestStream, body);
+			ProcessReceivedMessage(std::move(body), SessionID);
 
-			ProcessReceivedMessage(body);
+			if (Exchange)
+			{
+				ReplyToPost(*Exchange, InResponse);
+				return;
+			}
+			InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_ACCEPTED);
+			InResponse.setContentLength(0);
+			InResponse.send();
+		}
+		else if (Path == m_Options.Path && Method == "DELETE")
+		{
+			// Client-initiated session termination
+			if (!InRequest.has(SESSION_HEADER) || !IsConnectionRegistered(InRequest.get(SESSION_HEADER)))
+			{
+				SendSessionNotFound(InResponse);
+				return;
+			}
+			CloseSession(InRequest.get(SESSION_HEADER));
 
 			InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
-			std::ostream& responseStream = InResponse.send();
-			responseStream << "{\"status\":\"received\"}\n";
+			InResponse.set("Access-Control-Allow-Origin", "*");
+			InResponse.send();
 		}
 		else if (Method == "OPTIONS")
 		{
 			// Handle CORS preflight requests
 			InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
 			InResponse.set("Access-Control-Allow-Origin", "*");
-			InResponse.set("Access-Control-Allow-Headers", "Content-Type");
-			InResponse.set("Access-Control-Allow-Methods", "GET, POST, OPTIONS");
+			InResponse.set("Access-Control-Allow-Headers", "Content-Type, Mcp-Session-Id");
+			InResponse.set("Access-Control-Allow-Methods", "GET, POST, DELETE, OPTIONS");
 			InResponse.set("Access-Control-Max-Age", "86400");
 			std::ostream& responseStream = InResponse.send();
 			responseStream << "";
@@ -507,112 +863,442 @@ void HTTPTransportServer::HandleHTTPRequest(Poco::Net::HTTPServerRequest& InRequ
 	}
 }
 
-void HTTPTransportServer::RegisterSSEClient(const std::string& InClientID, Poco::Net::HTTPServerResponse& InResponse)
+std::string HTTPTransportServer::OpenEventStream(Poco::Net::HTTPServerRequest& InRequest,
+	Poco::Net::HTTPServerResponse& InResponse,
+	const bool InIncludeClientID)
 {
-	std::lock_guard Lock(m_ClientsMutex);
+	// A session's stream is addressed by its session ID; a stream opened without one only receives broadcasts
+	std::string ClientID;
+	if (InRequest.has(SESSION_HEADER))
+	{
+		ClientID = InRequest.get(SESSION_HEADER);
+		if (!IsConnectionRegistered(ClientID))
+		{
+			SendSessionNotFound(InResponse);
+			return {};
+		}
 
-	auto client = std::make_unique<SSEClient>();
-	client->ClientID = InClientID;
-	client->Response = &InResponse;
-	client->Stream = &InResponse.send();
-	client->ConnectedTime = std::chrono::steady_clock::now();
-	client->IsActive = true;
+		// A session has at most one stream; reconnecting replaces the previous one
+		m_SSEEngine.RemoveClient(ClientID);
+		InResponse.set(SESSION_HEADER, ClientID);
+	}
+	else
+	{
+		ClientID = GenerateUUID();
+	}
 
-	m_SSEClients[InClientID] = std::move(client);
-}
+	InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
+	InResponse.setContentType("text/event-stream");
+	InResponse.set("Cache-Control", "no-cache");
+	InResponse.set("Connection", "keep-alive");
+	InResponse.set("Access-Control-Allow-Origin", "*");
 
-void HTTPTransportServer::UnregisterSSEClient(const std::string& InClientID)
-{
-	std::lock_guard Lock(m_ClientsMutex);
+	// Send initial connection event
+	std::ostream& ResponseStream = InResponse.send();
+	if (InIncludeClientID)
+	{
+		ResponseStream << R"(data: {"type":"connection_established","clientId":")" << ClientID << "\"}\n\n";
+	}
+	else
+	{
+		ResponseStream << "data: {\"type\":\"connection_established\"}\n\n";
+	}
+	ResponseStream.flush();
 
-	if (const auto Iterator = m_SSEClients.find(InClientID); Iterator != m_SSEClients.end())
+	// From here on the socket belongs to the SSE engine; Poco no longer reads from or closes it
+	auto* RequestImpl = dynamic_cast<Poco::Net::HTTPServerRequestImpl*>(&InRequest);
+	if (RequestImpl == nullptr || !RegisterSSEClient(ClientID, RequestImpl->detachSocket()))
 	{
-		Iterator->second->IsActive = false;
-		m_SSEClients.erase(Iterator);
+		HandleRuntimeError("Failed to hand SSE stream to the engine");
+		return {};
 	}
+	return ClientID;
+}
+
+bool HTTPTransportServer::RegisterSSEClient(const std::string& InClientID, Poco::Net::StreamSocket InSocket)
+{
+	return m_SSEEngine.AddClient(InClientID, std::move(InSocket));
 }
 
+void HTTPTransportServer::UnregisterSSEClient(const std::string& InClientID) { m_SSEEngine.RemoveClient(InClientID); }
+
 void HTTPTransportServer::TransmitMessage(const JSONData& InMessage,
 	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
 {
-	std::lock_guard Lock(m_ClientsMutex);
+	// Formatted at most once and shared by every stream's queue
+	SSEEngine::Payload Event;
 
-	const std::string MessageStr = "data: " + InMessage.dump() + "\n\n";
+	if (!InConnectionIDs)
+	{
+		// A reply, or a batch of replies, belongs to one session and is never shown to the others
+		if (InMessage.is_array() || (!InMessage.contains("method") && InMessage.contains("id"))
+			|| InMessage.value("method", "") == ProgressNotification::METHOD)
+		{
+			Logger::Warning("Dropped a message for one request addressed to no session");
+			return;
+		}
+		Event = SSEEngine::MakeMessageEvent(InMessage);
+		m_SSEEngine.Broadcast(Event);
+		return;
+	}
 
-	auto Iterator = m_SSEClients.begin();
-	while (Iterator != m_SSEClients.end())
+	// Sessions map straight to their stream, so targeted delivery never touches other sessions
+	for (const ConnectionID& SessionID : *InConnectionIDs)
 	{
-		try
+		if (DeliverToPost(SessionID, InMessage))
 		{
-			if (Iterator->second->IsActive && Iterator->second->Stream != nullptr)
-			{
-				*Iterator->second->Stream << MessageStr;
-				Iterator->second->Stream->flush();
-				++Iterator;
-			}
-			else
+			continue;
+		}
+		if (!Event)
+		{
+			Event = SSEEngine::MakeMessageEvent(InMessage);
+		}
+		if (!m_SSEEngine.Send(SessionID, Event))
+		{
+			Logger::Warning("No open stream for session: " + SessionID);
+		}
+	}
+}
+
+void HTTPTransportServer::TransmitMessage(const MessageBase& InMessage,
+	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
+{
+	// Serialized once, already framed as an event: streams queue it as is and a POST takes the message inside it
+	auto Event = std::make_shared<SSEEvent>();
+	WriteFramedMessage(InMessage, Event->Data, SSEEngine::EVENT_PREFIX, SSEEngine::EVENT_SUFFIX);
+	const std::string_view Body = std::string_view{ Event->Data }.substr(SSEEngine::EVENT_PREFIX.size(),
+		Event->Data.size() - SSEEngine::EVENT_PREFIX.size() - SSEEngine::EVENT_SUFFIX.size());
+
+	// Only notifications may be dropped or coalesced, and only responses and progress can go back on a POST
+	std::optional<JSONData> ResponseID;
+	std::optional<JSONData> ProgressToken;
+	if (const auto* Response = dynamic_cast<const ResponseBase*>(&InMessage))
+	{
+		ResponseID = Response->ID;
+	}
+	else if (const auto* Notification = dynamic_cast<const NotificationBase*>(&InMessage))
+	{
+		Event->Kind = ESSEEventKind::Notification;
+		if (Notification->Method == ProgressNotification::METHOD && Notification->ParamsData)
+		{
+			if (const auto* Progress
+				= dynamic_cast<const ProgressNotification::Params*>(Notification->ParamsData.value().get()))
 			{
-				Iterator = m_SSEClients.erase(Iterator);
+				ProgressToken = Progress->ProgressToken;
+				Event->Kind = ESSEEventKind::Progress;
+				Event->ProgressToken = ProgressToken->dump();
 			}
 		}
-		catch (const std::exception&)
+	}
+
+	const auto Deliver = [&](const ConnectionID& InSessionID)
+	{
+		const std::shared_ptr<PostExchange> Exchange = FindExchange(InSessionID,
+			ResponseID ? &ResponseID.value() : nullptr,
+			ProgressToken ? &ProgressToken.value() : nullptr);
+		if (!Exchange)
+		{
+			return false;
+		}
+		DeliverToExchange(*Exchange, ResponseID.has_value(), std::string(Body));
+		return true;
+	};
+
+	if (!InConnectionIDs)
+	{
+		// A reply, or progress on a request, belongs to one session and is never shown to the others
+		if (ResponseID || ProgressToken)
+		{
+			Logger::Warning("Dropped a message for one request addressed to no session");
+			return;
+		}
+		m_SSEEngine.Broadcast(Event);
+		return;
+	}
+
+	for (const ConnectionID& SessionID : *InConnectionIDs)
+	{
+		if (!Deliver(SessionID) && !m_SSEEngine.Send(SessionID, Event))
 		{
-			// Client disconnected
-			Iterator = m_SSEClients.erase(Iterator);
+			Logger::Warning("No open stream for session: " + SessionID);
 		}
 	}
 }
 
-void HTTPTransportServer::ProcessReceivedMessage(const std::string& InMessage) { CallMessageRouter(InMessage); }
+std::shared_ptr<HTTPTransportServer::PostExchange> HTTPTransportServer::OpenExchange(
+	const ConnectionID& InSessionID,
+	const std::string_view InMessage,
+	const bool InCanStream,
+	std::optional<RequestID>& OutDuplicateID)
+{
+	const std::string_view SessionID{ InSessionID };
 
-VoidTask HTTPTransportServer::HandleGetMessageEndpoint(const Poco::Net::HTTPServerRequest& InRequest,
-	Poco::Net::HTTPServerResponse& InResponse)
+	auto Exchange = std::make_shared<PostExchange>();
+	std::vector<RequestID> IDs; // Alongside Exchange->Keys
+	const auto AddRequest = [&Exchange, &IDs, SessionID, InCanStream](const std::string_view InRequest)
+	{
+		const MessageEnvelope Envelope = ScanEnvelope(InRequest);
+		if (Envelope.Type != EMessageType::Request || !Envelope.ID)
+		{
+			return;
+		}
+		Exchange->Keys.emplace_back(MakeExchangeKey(SessionID, Envelope.ID->ToString()));
+		IDs.emplace_back(*Envelope.ID);
+
+		if (!InCanStream)
+		{
+			return;
+		}
+		if (const std::optional<std::string> Token = ScanProgressToken(InRequest))
+		{
+			Exchange->ProgressKeys.emplace_back(MakeExchangeKey(SessionID, *Token));
+		}
+	};
+
+	if (IsBatchText(InMessage))
+	{
+		JSONReader Reader(InMessage);
+		Reader.BeginArray();
+		while (Reader.NextElement())
+		{
+			AddRequest(Reader.ReadRaw());
+		}
+	}
+	else
+	{
+		AddRequest(InMessage);
+	}
+	if (Exchange->Keys.empty())
+	{
+		return nullptr;
+	}
+
+	std::lock_guard Lock(m_ExchangesMutex);
+	for (std::size_t Index = 0; Index < Exchange->Keys.size(); ++Index)
+	{
+		if (m_Exchanges.contains(Exchange->Keys[Index]))
+		{
+			OutDuplicateID = IDs[Index];
+			return nullptr;
+		}
+	}
+	for (const std::string& Key : Exchange->Keys)
+	{
+		m_Exchanges.emplace(Key, Exchange);
+	}
+	for (const std::string& Key : Exchange->ProgressKeys)
+	{
+		m_ProgressExchanges.emplace(Key, Exchange);
+	}
+	return Exchange;
+}
+
+void HTTPTransportServer::CloseExchange(const PostExchange& InExchange)
 {
-	(void)InRequest;
-	// Set SSE headers
-	InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
-	InResponse.setContentType("text/event-stream");
-	InResponse.set("Cache-Control", "no-cache");
-	InResponse.set("Connection", "keep-alive");
-	InResponse.set("Access-Control-Allow-Origin", "*");
-	InResponse.set("Access-Control-Allow-Headers", "Content-Type");
+	// Only erase our own entries; an ID may already be in flight again on a new POST
+	const auto EraseOwn = [&InExchange](auto& InMap, const std::string& InKey)
+	{
+		if (const auto Iter = InMap.find(InKey); Iter != InMap.end() && Iter->second.get() == &InExchange)
+		{
+			InMap.erase(Iter);
+		}
+	};
+
+	std::lock_guard Lock(m_ExchangesMutex);
+	for (const std::string& Key : InExchange.Keys)
+	{
+		EraseOwn(m_Exchanges, Key);
+	}
+	for (const std::string& Key : InExchange.ProgressKeys)
+	{
+		EraseOwn(m_ProgressExchanges, Key);
+	}
+}
+
+bool HTTPTransportServer::DeliverToPost(const ConnectionID& InSessionID, const JSONData& InMessage)
+{
+	// A batch reply is matched through the ID of any one of its responses
+	const JSONData* ResponseID{ nullptr };
+	if (InMessage.is_array())
+	{
+		const auto Iter = std::ranges::find_if(InMessage,
+			[](const JSONData& InElement)
+			{ return InElement.is_object() && InElement.contains("id") && !InElement.at("id").is_null(); });
+		ResponseID = Iter != InMessage.end() ? &Iter->at("id") : nullptr;
+	}
+	else if (!InMessage.contains("method") && InMessage.contains("id"))
+	{
+		ResponseID = &InMessage.at("id");
+	}
+
+	const JSONData* ProgressToken{ nullptr };
+	if (ResponseID == nullptr && InMessage.is_object() && InMessage.value("method", "") == "notifications/progress")
+	{
+		if (const auto Params = InMessage.find("params"); Params != InMessage.end() && Params->is_object())
+		{
+			if (const auto Token = Params->find("progressToken"); Token != Params->end())
+			{
+				ProgressToken = &*Token;
+			}
+		}
+	}
+
+	const std::shared_ptr<PostExchange> Exchange = FindExchange(InSessionID, ResponseID, ProgressToken);
+	if (!Exchange)
+	{
+		return false;
+	}
+	DeliverToExchange(*Exchange, ResponseID != nullptr, InMessage.dump());
+	return true;
+}
 
-	// Generate unique client ID
-	const std::string ClientID = GenerateUUID();
+std::shared_ptr<HTTPTransportServer::PostExchange> HTTPTransportServer::FindExchange(const ConnectionID& InSessionID,
+	const JSONData* InResponseID,
+	const JSONData* InProgressToken)
+{
+	if (InResponseID == nullptr && InProgressToken == nullptr)
+	{
+		return nullptr;
+	}
 
-	// Register an SSE client for message streaming
-	RegisterSSEClient(ClientID, InResponse);
+	std::lock_guard Lock(m_ExchangesMutex);
+	if (m_Exchanges.empty())
+	{
+		return nullptr;
+	}
 
-	// Keep connection alive and stream messages
-	co_await StreamMessagesToClient(ClientID);
+	if (InResponseID != nullptr)
+	{
+		const auto Iter = m_Exchanges.find(MakeExchangeKey(InSessionID, ExchangeKeyText(*InResponseID)));
+		return Iter != m_Exchanges.end() ? Iter->second : nullptr;
+	}
+	const auto Iter = m_ProgressExchanges.find(MakeExchangeKey(InSessionID, ExchangeKeyText(*InProgressToken)));
+	return Iter != m_ProgressExchanges.end() ? Iter->second : nullptr;
 }
 
-VoidTask HTTPTransportServer::StreamMessagesToClient(const std::string& InClientID)
+void HTTPTransportServer::DeliverToExchange(PostExchange& InExchange, const bool InIsResponse, std::string InBody)
 {
-	try
 	{
-		while (true)
+		std::lock_guard Lock(InExchange.Mutex);
+		if (InIsResponse)
+		{
+			InExchange.Response = std::move(InBody);
+		}
+		else
 		{
+			InExchange.Events.emplace_back(std::move(InBody));
+		}
+	}
+	InExchange.Ready.notify_one();
+}
+
+void HTTPTransportServer::ReplyToPost(PostExchange& InExchange, Poco::Net::HTTPServerResponse& InResponse)
+{
+	// Measured from the last thing sent, so a request that keeps reporting progress keeps its stream open
+	auto Deadline = std::chrono::steady_clock::now() + m_Options.RequestTimeout;
+	std::ostream* EventStream{ nullptr };
+
+	const auto HasWork = [&InExchange] { return InExchange.Response || !InExchange.Events.empty(); };
+
+	std::unique_lock Lock(InExchange.Mutex);
+	while (true)
+	{
+		if (!InExchange.Ready.wait_until(Lock, Deadline, HasWork))
+		{
+			// Timed out: once closed, whatever the handler sends goes to the session's stream. A message that
+			// slipped in before the close is still written here.
+			Lock.unlock();
+			CloseExchange(InExchange);
+			Lock.lock();
+			if (!HasWork())
 			{
-				std::lock_guard Lock(m_ClientsMutex);
-				if (auto Iterator = m_SSEClients.find(InClientID);
-					Iterator == m_SSEClients.end() || !Iterator->second->IsActive)
-				{
-					break;
-				}
+				break;
 			}
+		}
+
+		// Answered before anything else had to be sent: a plain JSON reply
+		if (EventStream == nullptr && InExchange.Events.empty())
+		{
+			const std::string Body = std::move(*InExchange.Response);
+			Lock.unlock();
+			CloseExchange(InExchange);
 
-			// Wait a bit before checking again
-			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
+			InResponse.setContentLength(static_cast<std::streamsize>(Body.size()));
+			InResponse.send() << Body;
+			return;
 		}
+
+		// Progress has to reach the client before the response: upgrade the reply to an event stream
+		if (EventStream == nullptr)
+		{
+			InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_OK);
+			InResponse.setContentType("text/event-stream");
+			InResponse.set("Cache-Control", "no-cache");
+			InResponse.setChunkedTransferEncoding(true);
+			EventStream = &InResponse.send();
+		}
+
+		std::deque<std::string> Events;
+		Events.swap(InExchange.Events);
+		const bool IsDone = InExchange.Response.has_value();
+		if (IsDone)
+		{
+			Events.emplace_back(std::move(*InExchange.Response));
+		}
+
+		// Written without the lock so the handler is never blocked on the client's socket
+		Lock.unlock();
+		for (const std::string& Data : Events)
+		{
+			*EventStream << SSEEngine::EVENT_PREFIX << Data << SSEEngine::EVENT_SUFFIX;
+		}
+		EventStream->flush();
+		if (IsDone || !*EventStream)
+		{
+			CloseExchange(InExchange);
+			return;
+		}
+		Deadline = std::chrono::steady_clock::now() + m_Options.RequestTimeout;
+		Lock.lock();
 	}
-	catch (const std::exception& Except)
+
+	if (EventStream == nullptr)
 	{
-		(void)Except;
-		// Client disconnected or error occurred
-		UnregisterSSEClient(InClientID);
+		InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_ACCEPTED);
+		InResponse.setContentLength(0);
+		InResponse.send();
 	}
+}
+
+void HTTPTransportServer::ProcessReceivedMessage(std::string InMessage,
+	const std::optional<ConnectionID>& InSessionID) const
+{
+	CallMessageRouter(std::move(InMessage), InSessionID);
+}
 
+void HTTPTransportServer::CloseSession(const ConnectionID& InSessionID)
+{
+	UnregisterConnection(InSessionID);
+	m_SSEEngine.RemoveClient(InSessionID);
+}
+
+void HTTPTransportServer::SendSessionNotFound(Poco::Net::HTTPServerResponse& InResponse)
+{
+	InResponse.setStatus(Poco::Net::HTTPResponse::HTTP_NOT_FOUND);
+	InResponse.setReason("Session Not Found");
+	InResponse.set("Access-Control-Allow-Origin", "*");
+	std::ostream& ResponseStream = InResponse.send();
+	ResponseStream << "404 Session Not Found\n";
+}
+
+VoidTask HTTPTransportServer::HandleGetMessageEndpoint(Poco::Net::HTTPServerRequest& InRequest,
+	Poco::Net::HTTPServerResponse& InResponse)
+{
+	InResponse.set("Access-Control-Allow-Headers", "Content-Type");
+
+	// The stream is serviced by the SSE engine, nothing to wait for here
+	(void)OpenEventStream(InRequest, InResponse, false);
 	co_return;
 }
 
@@ -622,4 +1308,9 @@ std::unique_ptr<ITransport> CreateHTTPTransportImpl(const HTTPTransportOptions&
 	return std::make_unique<HTTPTransportClient>(InOptions);
 }
 
+std::unique_ptr<ITransport> CreateHTTPServerTransportImpl(const HTTPTransportOptions& InOptions)
+{
+	return std::make_unique<HTTPTransportServer>(InOptions);
+}
+
 MCP_NAMESPACE_END
\ No newline at end of file
@@ -1,8 +1,18 @@
 #include "CoreSDK/Transport/ITransport.h"
 
+#include "CoreSDK/Messages/MessageBase.h"
+
 MCP_NAMESPACE_BEGIN
 
 // ITransport implementation
+void ITransport::TransmitMessage(const MessageBase& InMessage,
+	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
+{
+	JSONData Message;
+	InMessage.SerializeTo(Message);
+	TransmitMessage(Message, InConnectionIDs);
+}
+
 [[nodiscard]] bool ITransport::IsConnected() const { return m_CurrentState == ETransportState::Connected; }
 
 [[nodiscard]] ETransportState ITransport::GetState() const { return m_CurrentState; }
@@ -12,55 +22,46 @@ void ITransport::SetState(const ETransportState InNewState)
 	m_CurrentState = InNewState;
 	// TODO: Implement state change handler
 }
-void ITransport::SetMessageRouter(std::function<void(const JSONData&)> InRouter)
-{
-	m_MessageRouter = std::move(InRouter);
-}
+void ITransport::SetMessageRouter(MessageRouter InRouter) { m_MessageRouter = std::move(InRouter); }
 
-void ITransport::CallMessageRouter(const JSONData& InMessage) const
+void ITransport::CallMessageRouter(InboundMessage InMessage, const std::optional<ConnectionID>& InConnectionID) const
 {
 	if (m_MessageRouter)
 	{
-		m_MessageRouter(InMessage);
+		m_MessageRouter(std::move(InMessage), InConnectionID);
 	}
 }
 
 // Connection management implementations
-void ITransport::RegisterConnection(const ConnectionID& InConnectionID) { m_ActiveConnections.insert(InConnectionID); }
+void ITransport::RegisterConnection(const ConnectionID& InConnectionID)
+{
+	std::lock_guard Lock(m_ConnectionsMutex);
+	m_ActiveConnections.insert(InConnectionID);
+}
 
-void ITransport::UnregisterConnection(const ConnectionID& InConnectionID) { m_ActiveConnections.erase(InConnectionID); }
+void ITransport::UnregisterConnection(const ConnectionID& InConnectionID)
+{
+	std::lock_guard Lock(m_ConnectionsMutex);
+	m_ActiveConnections.erase(InConnectionID);
+}
 
 [[nodiscard]] bool ITransport::IsConnectionRegistered(const ConnectionID& InConnectionID) const
 {
+	std::lock_guard Lock(m_ConnectionsMutex);
 	return m_ActiveConnections.contains(InConnectionID);
 }
 
 [[nodiscard]] std::vector<ConnectionID> ITransport::GetActiveConnections() const
 {
+	std::lock_guard Lock(m_ConnectionsMutex);
 	return std::vector<ConnectionID>{ m_ActiveConnections.begin(), m_ActiveConnections.end() };
 }
 
-// TODO: @HalcyonOmega [Critical] - Implement this
-// MCPTask_Void
-// ITransport::TransmitMessage(const JSONData& InMessage,
-//                             const std::optional<std::vector<ConnectionID>>& InConnectionIDs) {
-//     if (InConnectionIDs.has_value()) {
-//         for (const auto& ConnectionID : InConnectionIDs.value()) {
-//             if (IsConnectionRegistered(ConnectionID)) {
-//                 co_await TransmitMessageToConnection(ConnectionID, InMessage);
-//             } else {
-//                 Logger::Warning("Connection not registered: " + ConnectionID);
-//             }
-//         }
-//     }
-// }
-
 // TransportFactory implementation
 std::unique_ptr<ITransport> TransportFactory::CreateTransport(const ETransportType InType,
 	const ETransportSide InSide,
 	const std::optional<std::unique_ptr<TransportOptions>>& InOptions)
 {
-	(void)InSide; // TODO: Use transport side parameter
 	if (!InOptions)
 	{
 		throw std::invalid_argument("Transport options are required");
@@ -70,6 +71,15 @@ std::unique_ptr<ITransport> TransportFactory::CreateTransport(const ETransportTy
 	{
 		case ETransportType::Stdio:
 		{
+			if (InSide == ETransportSide::Server)
+			{
+				const auto* ServerOptions = dynamic_cast<StdioServerTransportOptions*>(InOptions->get());
+				if (ServerOptions == nullptr)
+				{
+					throw std::invalid_argument("Invalid options for stdio server transport");
+				}
+				return CreateStdioServerTransport(*ServerOptions);
+			}
 			const auto* StdioOptions = dynamic_cast<StdioClientTransportOptions*>(InOptions->get());
 			if (StdioOptions == nullptr)
 			{
@@ -84,6 +94,10 @@ std::unique_ptr<ITransport> TransportFactory::CreateTransport(const ETransportTy
 			{
 				throw std::invalid_argument("Invalid options for HTTP transport");
 			}
+			if (InSide == ETransportSide::Server)
+			{
+				return CreateHTTPServerTransport(*HTTPOptions);
+			}
 			return CreateHTTPTransport(*HTTPOptions);
 		}
 		default:
@@ -98,6 +112,12 @@ std::unique_ptr<ITransport> TransportFactory::CreateStdioClientTransport(const S
 	return CreateStdioClientTransportImpl(InOptions);
 }
 
+std::unique_ptr<ITransport> TransportFactory::CreateStdioServerTransport(const StdioServerTransportOptions& InOptions)
+{
+	extern std::unique_ptr<ITransport> CreateStdioServerTransportImpl(const StdioServerTransportOptions& InImplOpts);
+	return CreateStdioServerTransportImpl(InOptions);
+}
+
 std::unique_ptr<ITransport> TransportFactory::CreateHTTPTransport(const HTTPTransportOptions& InOptions)
 {
 	// Forward declaration - will be implemented in HTTPTransport.cpp
@@ -105,4 +125,10 @@ std::unique_ptr<ITransport> TransportFactory::CreateHTTPTransport(const HTTPTran
 	return CreateHTTPTransportImpl(InOptions);
 }
 
+std::unique_ptr<ITransport> TransportFactory::CreateHTTPServerTransport(const HTTPTransportOptions& InOptions)
+{
+	extern std::unique_ptr<ITransport> CreateHTTPServerTransportImpl(const HTTPTransportOptions& InImplOpts);
+	return CreateHTTPServerTransportImpl(InOptions);
+}
+
 MCP_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,462 @@
+#include "CoreSDK/Transport/SSEEngine.h"
+
+#if !defined(_WIN32)
+	#include <cerrno>
+	#include <sys/socket.h>
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include "CoreSDK/Common/RuntimeError.h"
+
+MCP_NAMESPACE_BEGIN
+
+namespace
+{
+#if defined(MSG_NOSIGNAL)
+	constexpr int SEND_FLAGS{ MSG_NOSIGNAL };
+#else
+	constexpr int SEND_FLAGS{ 0 };
+#endif
+} // namespace
+
+SSEEngine::SSEEngine(const std::size_t InMaxQueuedEvents,
+	const std::size_t InMaxQueuedBytes,
+	const ESlowConsumerPolicy InPolicy,
+	IOReactor& InReactor)
+	: m_Reactor(InReactor),
+	  m_UseReactor(IOReactor::IsSupported()),
+	  m_MaxQueuedEvents(std::max<std::size_t>(InMaxQueuedEvents, 1)),
+	  m_MaxQueuedBytes(InMaxQueuedBytes),
+	  m_Policy(InPolicy)
+{}
+
+SSEEngine::~SSEEngine() noexcept
+{
+	try
+	{
+		CloseAll();
+	}
+	catch (...)
+	{
+		// Ignore errors during destruction
+	}
+}
+
+SSEEngine::Payload SSEEngine::MakeEvent(const std::string_view InData,
+	const ESSEEventKind InKind,
+	std::string InProgressToken)
+{
+	auto Event = std::make_shared<SSEEvent>();
+	Event->Data.reserve(EVENT_PREFIX.size() + InData.size() + EVENT_SUFFIX.size());
+	Event->Data.append(EVENT_PREFIX).append(InData).append(EVENT_SUFFIX);
+	Event->Kind = InKind;
+	Event->ProgressToken = std::move(InProgressToken);
+	return Event;
+}
+
+SSEEngine::Payload SSEEngine::MakeMessageEvent(const JSONData& InMessage)
+{
+	ESSEEventKind Kind{ ESSEEventKind::Message };
+	std::string ProgressToken;
+
+	// Only notifications (a method without an id) may be dropped or coalesced
+	if (const auto Method = InMessage.find("method"); Method != InMessage.end() && !InMessage.contains("id"))
+	{
+		Kind = ESSEEventKind::Notification;
+		if (Method->is_string() && Method->get_ref<const std::string&>() == "notifications/progress")
+		{
+			const auto Params = InMessage.find("params");
+			if (Params != InMessage.end() && Params->contains("progressToken"))
+			{
+				Kind = ESSEEventKind::Progress;
+				ProgressToken = Params->at("progressToken").dump();
+			}
+		}
+	}
+	return MakeEvent(InMessage.dump(), Kind, std::move(ProgressToken));
+}
+
+void SSEEngine::SetDisconnectCallback(DisconnectCallback InCallback)
+{
+	std::unique_lock Lock(m_Mutex);
+	m_OnDisconnect = std::move(InCallback);
+}
+
+bool SSEEngine::AddClient(const std::string& InClientID, Poco::Net::StreamSocket InSocket)
+{
+	auto Client = std::make_shared<SSEClient>();
+	Client->ClientID = InClientID;
+	Client->Socket = std::move(InSocket);
+	Client->Handle = Client->Socket.impl()->sockfd();
+	Client->ConnectedTime = std::chrono::steady_clock::now();
+
+	{
+		std::unique_lock Lock(m_Mutex);
+		if (!m_Clients.emplace(InClientID, Client).second)
+		{
+			HandleRuntimeError("SSE client already registered: " + InClientID);
+			Client->Socket.close();
+			return false;
+		}
+	}
+
+	if (m_UseReactor)
+	{
+		Client->Socket.setBlocking(false);
+
+		// Readable interest only serves to notice the peer leaving; writable interest is added while data is queued
+		const std::weak_ptr<SSEClient> WeakClient = Client;
+		if (!m_Reactor.Watch(static_cast<NativeHandle>(Client->Handle),
+				EIOEvent::Readable,
+				[this, WeakClient](const EIOEvent InEvents)
+				{
+					if (const std::shared_ptr<SSEClient> Target = WeakClient.lock())
+					{
+						OnSocketEvent(Target, InEvents);
+					}
+				}))
+		{
+			Close(Client, ESSECloseReason::PeerLeft);
+			return false;
+		}
+	}
+	return true;
+}
+
+void SSEEngine::RemoveClient(const std::string& InClientID)
+{
+	std::shared_ptr<SSEClient> Client;
+	{
+		std::shared_lock Lock(m_Mutex);
+		if (const auto Iter = m_Clients.find(InClientID); Iter != m_Clients.end())
+		{
+			Client = Iter->second;
+		}
+	}
+	if (Client)
+	{
+		Close(Client, ESSECloseReason::Removed);
+	}
+}
+
+void SSEEngine::CloseAll()
+{
+	std::vector<std::shared_ptr<SSEClient>> Clients;
+	{
+		std::shared_lock Lock(m_Mutex);
+		Clients.reserve(m_Clients.size());
+		for (const auto& [ID, Client] : m_Clients)
+		{
+			Clients.push_back(Client);
+		}
+	}
+	for (const std::shared_ptr<SSEClient>& Client : Clients)
+	{
+		Close(Client, ESSECloseReason::Removed);
+	}
+}
+
+bool SSEEngine::Send(const std::string& InClientID, const Payload& InEvent)
+{
+	std::shared_ptr<SSEClient> Client;
+	{
+		std::shared_lock Lock(m_Mutex);
+		const auto Iter = m_Clients.find(InClientID);
+		if (Iter == m_Clients.end())
+		{
+			return false;
+		}
+		Client = Iter->second;
+	}
+
+	bool IsHealthy;
+	{
+		std::lock_guard ClientLock(Client->Mutex);
+		IsHealthy = Enqueue(*Client, InEvent);
+	}
+	if (!IsHealthy)
+	{
+		Close(Client, ESSECloseReason::SlowConsumer);
+	}
+	return true;
+}
+
+void SSEEngine::Broadcast(const Payload& InEvent)
+{
+	std::vector<std::shared_ptr<SSEClient>> Failed;
+	{
+		std::shared_lock Lock(m_Mutex);
+		for (const auto& [ID, Client] : m_Clients)
+		{
+			std::lock_guard ClientLock(Client->Mutex);
+			if (!Enqueue(*Client, InEvent))
+			{
+				Failed.push_back(Client);
+			}
+		}
+	}
+	for (const std::shared_ptr<SSEClient>& Client : Failed)
+	{
+		Close(Client, ESSECloseReason::SlowConsumer);
+	}
+}
+
+std::size_t SSEEngine::GetClientCount() const
+{
+	std::shared_lock Lock(m_Mutex);
+	return m_Clients.size();
+}
+
+std::optional<SSEClientStats> SSEEngine::GetClientStats(const std::string& InClientID) const
+{
+	std::shared_lock Lock(m_Mutex);
+	const auto Iter = m_Clients.find(InClientID);
+	if (Iter == m_Clients.end())
+	{
+		return std::nullopt;
+	}
+
+	const SSEClient& Client = *Iter->second;
+	std::lock_guard ClientLock(Client.Mutex);
+	return SSEClientStats{ Client.Queue.size(), Client.QueuedBytes, Client.DroppedEvents, Client.CoalescedEvents };
+}
+
+SSEEngineStats SSEEngine::GetStats() const
+{
+	SSEEngineStats Stats;
+	{
+		std::shared_lock Lock(m_Mutex);
+		Stats.Clients = m_Clients.size();
+		for (const auto& [ID, Client] : m_Clients)
+		{
+			std::lock_guard ClientLock(Client->Mutex);
+			Stats.QueuedEvents += Client->Queue.size();
+			Stats.QueuedBytes += Client->QueuedBytes;
+			Stats.MaxQueueDepth = std::max(Stats.MaxQueueDepth, Client->Queue.size());
+		}
+	}
+	Stats.DroppedEvents = m_DroppedEvents;
+	Stats.CoalescedEvents = m_CoalescedEvents;
+	Stats.SlowConsumerDisconnects = m_SlowConsumerDisconnects;
+	return Stats;
+}
+
+bool SSEEngine::Enqueue(SSEClient& InClient, const Payload& InEvent)
+{
+	if (InClient.IsClosed)
+	{
+		return true;
+	}
+
+	// The front event may be partially written and must stay in place
+	const std::size_t FirstMovable = InClient.FrontOffset > 0 ? 1 : 0;
+
+	if (m_Policy == ESlowConsumerPolicy::CoalesceProgress && InEvent->Kind == ESSEEventKind::Progress)
+	{
+		// Only the latest progress per token matters to a client that has not read the earlier one yet
+		for (std::size_t Index = FirstMovable; Index < InClient.Queue.size(); ++Index)
+		{
+			Payload& Queued = InClient.Queue[Index];
+			if (Queued->Kind == ESSEEventKind::Progress && Queued->ProgressToken == InEvent->ProgressToken)
+			{
+				InClient.QueuedBytes = InClient.QueuedBytes - Queued->Data.size() + InEvent->Data.size();
+				Queued = InEvent;
+				++InClient.CoalescedEvents;
+				++m_CoalescedEvents;
+				return true;
+			}
+		}
+	}
+
+	if (m_UseReactor && !MakeRoom(InClient, *InEvent))
+	{
+		++m_SlowConsumerDisconnects;
+		return false;
+	}
+
+	InClient.Queue.push_back(InEvent);
+	InClient.QueuedBytes += InEvent->Data.size();
+	if (!m_UseReactor)
+	{
+		// No multiplexer on this platform, write through on the sender's thread
+		return Flush(InClient);
+	}
+
+	if (!InClient.IsFlushing)
+	{
+		InClient.IsFlushing = true;
+		m_Reactor.Modify(static_cast<NativeHandle>(InClient.Handle), EIOEvent::Readable | EIOEvent::Writable);
+	}
+	return true;
+}
+
+bool SSEEngine::MakeRoom(SSEClient& InClient, const SSEEvent& InIncoming)
+{
+	const auto IsFull = [this, &InClient, &InIncoming]
+	{
+		return !InClient.Queue.empty()
+			&& (InClient.Queue.size() >= m_MaxQueuedEvents
+				|| InClient.QueuedBytes + InIncoming.Data.size() > m_MaxQueuedBytes);
+	};
+
+	while (IsFull())
+	{
+		if (m_Policy == ESlowConsumerPolicy::Disconnect)
+		{
+			return false;
+		}
+
+		// Evict the oldest notification that has not started going out
+		const auto Begin = InClient.Queue.begin() + (InClient.FrontOffset > 0 ? 1 : 0);
+		const auto Victim = std::find_if(Begin,
+			InClient.Queue.end(),
+			[](const Payload& InQueued) { return InQueued->Kind != ESSEEventKind::Message; });
+		if (Victim == InClient.Queue.end())
+		{
+			// Backed up with nothing but responses; the client is not keeping up at all
+			return false;
+		}
+
+		InClient.QueuedBytes -= (*Victim)->Data.size();
+		InClient.Queue.erase(Victim);
+		++InClient.DroppedEvents;
+		++m_DroppedEvents;
+	}
+	return true;
+}
+
+void SSEEngine::OnSocketEvent(const std::shared_ptr<SSEClient>& InClient, const EIOEvent InEvents)
+{
+	bool IsHealthy{ !HasIOEvent(InEvents, EIOEvent::Closed) };
+
+#if !defined(_WIN32)
+	if (IsHealthy && HasIOEvent(InEvents, EIOEvent::Readable))
+	{
+		// Clients do not send anything on an event stream; drain whatever arrives and watch for end of stream
+		char Discard[512];
+		while (true)
+		{
+			const auto Count = recv(InClient->Handle, Discard, sizeof(Discard), 0);
+			if (Count > 0)
+			{
+				continue;
+			}
+			if (Count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+			{
+				break;
+			}
+			IsHealthy = false;
+			break;
+		}
+	}
+#endif
+
+	if (IsHealthy && HasIOEvent(InEvents, EIOEvent::Writable))
+	{
+		std::lock_guard ClientLock(InClient->Mutex);
+		IsHealthy = Flush(*InClient);
+		if (IsHealthy && InClient->Queue.empty() && InClient->IsFlushing)
+		{
+			InClient->IsFlushing = false;
+			m_Reactor.Modify(static_cast<NativeHandle>(InClient->Handle), EIOEvent::Readable);
+		}
+	}
+
+	if (!IsHealthy)
+	{
+		Close(InClient, ESSECloseReason::PeerLeft);
+	}
+}
+
+bool SSEEngine::Flush(SSEClient& InClient)
+{
+	while (!InClient.Queue.empty())
+	{
+		const std::string& Front = InClient.Queue.front()->Data;
+		const char* Data = Front.data() + InClient.FrontOffset;
+		const std::size_t Remaining = Front.size() - InClient.FrontOffset;
+
+#if defined(_WIN32)
+		int Written{ 0 };
+		try
+		{
+			Written = InClient.Socket.sendBytes(Data, static_cast<int>(Remaining));
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+		if (Written <= 0)
+		{
+			return false;
+		}
+#else
+		const auto Written = send(InClient.Handle, Data, Remaining, SEND_FLAGS);
+		if (Written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			// A full socket buffer is not a failure, the reactor calls back once there is room
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+#endif
+
+		InClient.FrontOffset += static_cast<std::size_t>(Written);
+		if (InClient.FrontOffset == Front.size())
+		{
+			InClient.QueuedBytes -= Front.size();
+			InClient.Queue.pop_front();
+			InClient.FrontOffset = 0;
+		}
+	}
+	return true;
+}
+
+void SSEEngine::Close(const std::shared_ptr<SSEClient>& InClient, const ESSECloseReason InReason)
+{
+	{
+		std::lock_guard ClientLock(InClient->Mutex);
+		if (InClient->IsClosed)
+		{
+			return;
+		}
+		InClient->IsClosed = true;
+		InClient->Queue.clear();
+		InClient->QueuedBytes = 0;
+	}
+
+	if (m_UseReactor)
+	{
+		m_Reactor.Unwatch(static_cast<NativeHandle>(InClient->Handle));
+	}
+	try
+	{
+		InClient->Socket.close();
+	}
+	catch (...)
+	{
+		// Already closed by the peer
+	}
+
+	DisconnectCallback OnDisconnect;
+	{
+		std::unique_lock Lock(m_Mutex);
+		if (const auto Iter = m_Clients.find(InClient->ClientID); Iter != m_Clients.end() && Iter->second == InClient)
+		{
+			m_Clients.erase(Iter);
+		}
+		OnDisconnect = m_OnDisconnect;
+	}
+	if (OnDisconnect)
+	{
+		OnDisconnect(InClient->ClientID, InReason);
+	}
+}
+
+MCP_NAMESPACE_END
@@ -1,18 +1,57 @@
 #include "CoreSDK/Transport/StdioTransport.h"
 
-#include <Poco/PipeStream.h>
-#include <Poco/StreamCopier.h>
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <unistd.h>
+#endif
 
-#include <chrono>
-#include <iostream>
 #include <stdexcept>
-#include <thread>
 #include <utility>
 
 #include "CoreSDK/Common/RuntimeError.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/JSON/WireFormat.h"
 
 MCP_NAMESPACE_BEGIN
 
+namespace
+{
+	// Text messages are written straight into the buffer; the binary encoders need a document to work from
+	void EncodeMessage(const MessageBase& InMessage, const EWireFormat InFormat, std::string& OutBuffer)
+	{
+		if (InFormat == EWireFormat::JSON)
+		{
+			WriteFramedMessage(InMessage, OutBuffer);
+			return;
+		}
+		JSONData Document;
+		InMessage.SerializeTo(Document);
+		BinaryFrame::Write(Document, InFormat, OutBuffer);
+	}
+
+	void EncodeDocument(const JSONData& InMessage, const EWireFormat InFormat, std::string& OutBuffer)
+	{
+		if (InFormat == EWireFormat::JSON)
+		{
+			JSONWriter(OutBuffer).WriteValue(InMessage);
+			return;
+		}
+		BinaryFrame::Write(InMessage, InFormat, OutBuffer);
+	}
+
+	void RouteFrame(const ITransport& InTransport, const std::string_view InFrame)
+	{
+		if (!InFrame.empty() && BinaryFrame::IsTag(InFrame.front()))
+		{
+			InTransport.CallMessageRouter(BinaryFrame::Read(InFrame));
+			return;
+		}
+		// The frame is lent straight out of the reader's buffer; only a handler queued for later copies it
+		InTransport.CallMessageRouter(InboundMessage{ std::in_place_type<std::string_view>, InFrame });
+	}
+} // namespace
+
 // StdioClientTransport Implementation
 StdioClientTransport::StdioClientTransport(StdioClientTransportOptions InOptions) : m_Options(std::move(InOptions)) {}
 
@@ -22,7 +61,7 @@ StdioClientTransport::~StdioClientTransport()
 	{
 		try
 		{
-			Disconnect().await_resume();
+			SyncWait(Disconnect());
 		}
 		catch (...)
 		{
@@ -72,20 +111,38 @@ VoidTask StdioClientTransport::Connect()
 				m_StdoutPipe.get()));
 		}
 
-		// Create streams
-		m_StdinStream = std::make_unique<Poco::PipeOutputStream>(*m_StdinPipe);
-		m_StdoutStream = std::make_unique<Poco::PipeInputStream>(*m_StdoutPipe);
+		// Outbound messages are batched onto the child's stdin by a single writer
+		m_StdinWriter = std::make_unique<CoalescingWriter>(m_StdinPipe->writeHandle(),
+			m_Options.FlushLatency,
+			m_Options.MaxBatchBytes);
+
+		// Child output is serviced by the shared reactor rather than a thread per pipe
+		m_StdoutReader = std::make_unique<StdioReader>(
+			m_StdoutPipe->readHandle(),
+			[this](const std::string_view InFrame) { ProcessFrame(InFrame); },
+			[this]
+			{
+				HandleRuntimeError("Process closed its stdout");
+				SetState(ETransportState::Error);
+			},
+			&IOReactor::Shared());
 		if (m_Options.UseStderr)
 		{
-			m_StderrStream = std::make_unique<Poco::PipeInputStream>(*m_StderrPipe);
+			m_StderrReader = std::make_unique<StdioReader>(
+				m_StderrPipe->readHandle(),
+				[](const std::string_view InLine) { HandleRuntimeError("Process stderr: " + std::string(InLine)); },
+				StdioReader::CloseCallback{},
+				&IOReactor::Shared());
 		}
 
-		// Start reading thread
-		m_ShouldStop = false;
-		// TODO: @HalcyonOmega - Thread should start automatically
-		// m_ReadThread.start(*this);
-
 		SetState(ETransportState::Connected);
+
+		m_StdinWriter->Start();
+		m_StdoutReader->Start();
+		if (m_StderrReader)
+		{
+			m_StderrReader->Start();
+		}
 	}
 	catch (const std::exception& e)
 	{
@@ -106,18 +163,24 @@ VoidTask StdioClientTransport::Disconnect()
 
 	try
 	{
-		m_ShouldStop = true;
-
-		// Close streams to wake up reading thread
-		if (m_StdinStream)
+		// Flush pending writes, then close stdin so the process can wind down
+		if (m_StdinWriter)
+		{
+			m_StdinWriter->Stop();
+		}
+		if (m_StdinPipe)
 		{
-			m_StdinStream->close();
+			m_StdinPipe->close(Poco::Pipe::CLOSE_WRITE);
 		}
 
-		// Wait for the reading thread to finish
-		if (m_ReadThread.joinable())
+		// Wait for the readers to finish
+		if (m_StdoutReader)
+		{
+			m_StdoutReader->Stop();
+		}
+		if (m_StderrReader)
 		{
-			m_ReadThread.join();
+			m_StderrReader->Stop();
 		}
 
 		Cleanup();
@@ -134,52 +197,31 @@ VoidTask StdioClientTransport::Disconnect()
 
 std::string StdioClientTransport::GetConnectionInfo() const { return "Stdio transport to: " + m_Options.Command; }
 
-// TODO: @HalcyonOmega Cleanup
-void StdioClientTransport::ReaderThread(std::stop_token InStopToken) {}
+std::vector<EWireFormat> StdioClientTransport::GetWireFormats() const { return m_Options.WireFormats; }
 
-void StdioClientTransport::run() { ProcessIncomingData(); }
+void StdioClientTransport::SetWireFormat(const EWireFormat InFormat) { m_WireFormat = InFormat; }
 
-void StdioClientTransport::ProcessIncomingData()
-{
-	static constexpr std::chrono::milliseconds DEFAULT_SLEEP_FOR{ 10 };
+void StdioClientTransport::ProcessFrame(const std::string_view InFrame) { RouteFrame(*this, InFrame); }
 
-	std::string line;
-	while (!m_ShouldStop)
-	{
-		try
-		{
-			if (m_StdoutStream && m_StdoutStream->good())
-			{
-				std::getline(*m_StdoutStream, line);
-				if (!line.empty())
-				{
-					ProcessLine(line);
-				}
-			}
-			else
-			{
-				std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_SLEEP_FOR));
-			}
-		}
-		catch (const std::exception& e)
-		{
-			if (!m_ShouldStop)
-			{
-				HandleRuntimeError("Error reading from process: " + std::string(e.what()));
-			}
-			break;
-		}
-	}
+void StdioClientTransport::TransmitMessage(const JSONData& InMessage,
+	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
+{
+	(void)InConnectionIDs;
+	const EWireFormat Format = m_WireFormat;
+	Send([&InMessage, Format](std::string& OutBuffer) { EncodeDocument(InMessage, Format, OutBuffer); });
 }
 
-void StdioClientTransport::ProcessLine(const std::string& InLine) { CallMessageRouter(JSONData::parse(InLine)); }
-
-void StdioClientTransport::TransmitMessage(const JSONData& InMessage,
+void StdioClientTransport::TransmitMessage(const MessageBase& InMessage,
 	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
 {
 	(void)InConnectionIDs;
+	const EWireFormat Format = m_WireFormat;
+	Send([&InMessage, Format](std::string& OutBuffer) { EncodeMessage(InMessage, Format, OutBuffer); });
+}
 
-	if (!m_StdinStream || !IsConnected())
+template <typename SerializeFunction> void StdioClientTransport::Send(const SerializeFunction& InSerialize)
+{
+	if (!m_StdinWriter || !IsConnected())
 	{
 		HandleRuntimeError("Transport not connected");
 		return;
@@ -187,11 +229,13 @@ void StdioClientTransport::TransmitMessage(const JSONData& InMessage,
 
 	try
 	{
-		std::lock_guard lock(m_WriteMutex);
-
-		const std::string MessageStr = InMessage.dump() + "\n";
-		m_StdinStream->write(MessageStr.c_str(), MessageStr.length());
-		m_StdinStream->flush();
+		// The writer adds the newline when it writes the message out
+		std::string Message = m_StdinWriter->AcquireBuffer();
+		InSerialize(Message);
+		if (!m_StdinWriter->Enqueue(std::move(Message)))
+		{
+			HandleRuntimeError("Error writing message: stdin writer closed");
+		}
 	}
 	catch (const std::exception& e)
 	{
@@ -215,9 +259,9 @@ void StdioClientTransport::Cleanup()
 	}
 
 	// Close streams
-	m_StdinStream.reset();
-	m_StdoutStream.reset();
-	m_StderrStream.reset();
+	m_StdinWriter.reset();
+	m_StdoutReader.reset();
+	m_StderrReader.reset();
 
 	// Close pipes
 	m_StdinPipe.reset();
@@ -228,7 +272,7 @@ void StdioClientTransport::Cleanup()
 }
 
 // StdioServerTransport Implementation
-StdioServerTransport::StdioServerTransport() {}
+StdioServerTransport::StdioServerTransport(StdioServerTransportOptions InOptions) : m_Options(std::move(InOptions)) {}
 
 StdioServerTransport::~StdioServerTransport()
 {
@@ -236,7 +280,7 @@ StdioServerTransport::~StdioServerTransport()
 	{
 		try
 		{
-			Disconnect().await_resume();
+			SyncWait(Disconnect());
 		}
 		catch (...)
 		{
@@ -258,11 +302,24 @@ VoidTask StdioServerTransport::Connect()
 		SetState(ETransportState::Connecting);
 
 		// Server uses stdin/stdout directly
-		m_ShouldStop = false;
-		// TODO: @HalcyonOmega This should start automatically
-		// m_ReadThread.start(*this);
+#if defined(_WIN32)
+		const NativeHandle StdinHandle = GetStdHandle(STD_INPUT_HANDLE);
+		const NativeHandle StdoutHandle = GetStdHandle(STD_OUTPUT_HANDLE);
+#else
+		const NativeHandle StdinHandle = STDIN_FILENO;
+		const NativeHandle StdoutHandle = STDOUT_FILENO;
+#endif
+		m_StdoutWriter = std::make_unique<CoalescingWriter>(StdoutHandle,
+			m_Options.FlushLatency,
+			m_Options.MaxBatchBytes);
+		m_StdinReader = std::make_unique<StdioReader>(StdinHandle,
+			[this](const std::string_view InFrame) { ProcessFrame(InFrame); },
+			[] { HandleRuntimeError("Stdin closed"); });
 
 		SetState(ETransportState::Connected);
+
+		m_StdoutWriter->Start();
+		m_StdinReader->Start();
 	}
 	catch (const std::exception& e)
 	{
@@ -281,12 +338,16 @@ VoidTask StdioServerTransport::Disconnect()
 
 	try
 	{
-		m_ShouldStop = true;
-
-		// Wait for the reading thread to finish
-		if (m_ReadThread.joinable())
+		// Wait for the reader to finish
+		if (m_StdinReader)
+		{
+			m_StdinReader->Stop();
+			m_StdinReader.reset();
+		}
+		if (m_StdoutWriter)
 		{
-			m_ReadThread.join();
+			m_StdoutWriter->Stop();
+			m_StdoutWriter.reset();
 		}
 
 		SetState(ETransportState::Disconnected);
@@ -302,53 +363,45 @@ VoidTask StdioServerTransport::Disconnect()
 
 std::string StdioServerTransport::GetConnectionInfo() const { return "Stdio server transport (stdin/stdout)"; }
 
-void StdioServerTransport::run() { ProcessIncomingData(); }
+std::vector<EWireFormat> StdioServerTransport::GetWireFormats() const { return m_Options.WireFormats; }
 
-void StdioServerTransport::ProcessIncomingData()
-{
-	std::string line;
-	while (!m_ShouldStop)
-	{
-		try
-		{
-			if (std::getline(std::cin, line))
-			{
-				if (!line.empty())
-				{
-					ProcessLine(line);
-				}
-			}
-			else
-			{
-				// EOF reached
-				break;
-			}
-		}
-		catch (const std::exception& e)
-		{
-			if (!m_ShouldStop)
-			{
-				HandleRuntimeError("Error reading from stdin: " + std::string(e.what()));
-			}
-			break;
-		}
-	}
-}
+void StdioServerTransport::SetWireFormat(const EWireFormat InFormat) { m_WireFormat = InFormat; }
 
-void StdioServerTransport::ProcessLine(const std::string& InLine) { CallMessageRouter(JSONData::parse(InLine)); }
+void StdioServerTransport::ProcessFrame(const std::string_view InFrame) { RouteFrame(*this, InFrame); }
 
 void StdioServerTransport::TransmitMessage(const JSONData& InMessage,
 	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
 {
 	(void)InConnectionIDs;
+	const EWireFormat Format = m_WireFormat;
+	Send([&InMessage, Format](std::string& OutBuffer) { EncodeDocument(InMessage, Format, OutBuffer); });
+}
 
-	try
+void StdioServerTransport::TransmitMessage(const MessageBase& InMessage,
+	const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
+{
+	(void)InConnectionIDs;
+	const EWireFormat Format = m_WireFormat;
+	Send([&InMessage, Format](std::string& OutBuffer) { EncodeMessage(InMessage, Format, OutBuffer); });
+}
+
+template <typename SerializeFunction> void StdioServerTransport::Send(const SerializeFunction& InSerialize)
+{
+	if (!m_StdoutWriter)
 	{
-		std::lock_guard lock(m_WriteMutex);
+		HandleRuntimeError("Transport not connected");
+		return;
+	}
 
-		const std::string MessageStr = InMessage.dump() + "\n";
-		std::cout << MessageStr;
-		std::cout.flush();
+	try
+	{
+		// The writer adds the newline when it writes the message out
+		std::string Message = m_StdoutWriter->AcquireBuffer();
+		InSerialize(Message);
+		if (!m_StdoutWriter->Enqueue(std::move(Message)))
+		{
+			HandleRuntimeError("Error writing message: stdout writer closed");
+		}
 	}
 	catch (const std::exception& e)
 	{
@@ -362,4 +415,9 @@ std::unique_ptr<ITransport> CreateStdioClientTransportImpl(const StdioClientTran
 	return std::make_unique<StdioClientTransport>(InOptions);
 }
 
+std::unique_ptr<ITransport> CreateStdioServerTransportImpl(const StdioServerTransportOptions& InOptions)
+{
+	return std::make_unique<StdioServerTransport>(InOptions);
+}
+
 MCP_NAMESPACE_END
\ No newline at end of file
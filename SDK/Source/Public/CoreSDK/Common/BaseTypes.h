@@ -2,6 +2,8 @@
 #include <algorithm>
 #include <optional>
 
+#include "JSONProxy.h"
+
 class BoundedDouble
 {
 
@@ -99,4 +101,12 @@ private:
 	double m_Min{ 0.0 };
 	double m_Max{ 0.0 };
 	bool m_BoundsLocked{ true };
+};
+
+// Only the value travels; a parsed value is clamped to the bounds of the one it is read into
+template <> struct nlohmann::adl_serializer<BoundedDouble>
+{
+	static void to_json(json& j, const BoundedDouble& value) { j = value.GetValue(); }
+
+	static void from_json(const json& j, BoundedDouble& value) { value = j.get<double>(); }
 };
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "CoreSDK/Common/Macros.h"
 #include "JSONProxy.h"
+#include "Utilities/JSON/WireFormat.h"
 
 MCP_NAMESPACE_BEGIN
 
@@ -34,13 +36,28 @@ struct SamplingCapability
 	DEFINE_TYPE_JSON(SamplingCapability, ADDITIONALPROPERTIESKEY)
 };
 
+/**
+ * Binary encodings a peer can exchange messages in. A client lists the ones it offers in order of preference; the
+ * server answers with the single one it picked, and both switch to it once initialize has completed.
+ */
+struct BinaryEncodingCapability
+{
+	std::vector<EWireFormat> Formats;
+
+	JSON_KEY(FORMATSKEY, Formats, "formats")
+
+	DEFINE_TYPE_JSON(BinaryEncodingCapability, FORMATSKEY)
+};
+
 struct ExperimentalCapability
 {
+	std::optional<BinaryEncodingCapability> BinaryEncoding{ std::nullopt };
 	JSONData AdditionalProperties{};
 
+	JSON_KEY(BINARYENCODINGKEY, BinaryEncoding, "binaryEncoding")
 	JSON_KEY(ADDITIONALPROPERTIESKEY, AdditionalProperties, "additionalProperties")
 
-	DEFINE_TYPE_JSON(ExperimentalCapability, ADDITIONALPROPERTIESKEY)
+	DEFINE_TYPE_JSON(ExperimentalCapability, BINARYENCODINGKEY, ADDITIONALPROPERTIESKEY)
 };
 
 struct LoggingCapability
@@ -156,12 +173,12 @@ struct ClientCapabilities
 		std::nullopt
 	}; // Present if the client supports eliciting user input.
 
-	JSON_KEY(ROOTSKEY, Roots, "roots")
+	JSON_KEY(EXPERIMENTALKEY, Experimental, "experimental")
 	JSON_KEY(SAMPLINGKEY, Sampling, "sampling")
-	JSON_KEY(EXPERIMENTALKEY, Elicitation, "elicitation")
-	JSON_KEY(ELICITATIONKEY, Experimental, "experimental")
+	JSON_KEY(ROOTSKEY, Roots, "roots")
+	JSON_KEY(ELICITATIONKEY, Elicitation, "elicitation")
 
-	DEFINE_TYPE_JSON(ClientCapabilities, ROOTSKEY, SAMPLINGKEY, EXPERIMENTALKEY)
+	DEFINE_TYPE_JSON(ClientCapabilities, EXPERIMENTALKEY, SAMPLINGKEY, ROOTSKEY, ELICITATIONKEY)
 };
 
 // ServerCapabilities {
@@ -11,6 +11,17 @@
 #include "JSONProxy.h"
 #include "URIProxy.h"
 
+// Media types travel as their string form
+template <> struct nlohmann::adl_serializer<Poco::Net::MediaType>
+{
+	static void to_json(json& j, const Poco::Net::MediaType& mediaType) { j = mediaType.toString(); }
+
+	static void from_json(const json& j, Poco::Net::MediaType& mediaType)
+	{
+		mediaType = Poco::Net::MediaType(j.get<std::string>());
+	}
+};
+
 MCP_NAMESPACE_BEGIN
 
 // TODO: @HalcyonOmega - Attempt to fix Poco::Data::BLOB instead of this
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <concepts>
 #include <future>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -12,6 +15,10 @@
 #include "CoreSDK/Transport/ITransport.h"
 #include "IMCP.h"
 #include "Utilities/Async/Task.h"
+#include "Utilities/Async/TaskScope.h"
+#include "Utilities/Async/ThreadPool.h"
+#include "Utilities/Async/TimerWheel.h"
+#include "Utilities/IO/IOReactor.h"
 
 MCP_NAMESPACE_BEGIN
 
@@ -28,16 +35,19 @@ enum class EProtocolState
 };
 
 DEFINE_ENUM_JSON(EProtocolState,
-	{ { EProtocolState::Uninitialized, "uninitialized" },
-		{ EProtocolState::Initializing, "initializing" },
-		{ EProtocolState::Initialized, "initialized" },
-		{ EProtocolState::Error, "error" },
-		{ EProtocolState::Shutdown, "shutdown" } });
+	{ EProtocolState::Uninitialized, "uninitialized" },
+	{ EProtocolState::Initializing, "initializing" },
+	{ EProtocolState::Initialized, "initialized" },
+	{ EProtocolState::Error, "error" },
+	{ EProtocolState::Shutdown, "shutdown" })
 
 // Base protocol handler
 class MCPProtocol
 {
 public:
+	// Used when the transport does not set its own request timeout
+	static constexpr std::chrono::milliseconds DEFAULT_REQUEST_TIMEOUT{ 60000 };
+
 	explicit MCPProtocol(std::unique_ptr<ITransport> InTransport, bool InWarnOnDuplicateMessageHandlers);
 	virtual ~MCPProtocol() = default;
 
@@ -52,13 +62,38 @@ public:
 	// Core protocol operations
 	Task<PingResponse> Ping(const PingRequest& InRequest);
 
+	/**
+	 * Run a coroutine that nobody awaits, such as a handler that has to await requests of its own. The protocol joins
+	 * it before it is destroyed.
+	 */
+	template <typename T> void Spawn(Task<T> InTask) { m_Tasks.Spawn(std::move(InTask)); }
+
 	// Protocol version validation
 	static const std::vector<std::string> SUPPORTED_PROTOCOL_VERSIONS;
 	static void ValidateProtocolVersion(const std::string& InVersion);
 
+	/**
+	 * Send a message through the transport.
+	 * @param InMessage The message to send
+	 * @param InConnections Sessions to deliver to. When omitted inside a message handler, responses, requests,
+	 * progress and cancellation go to the session being served and other notifications to every session.
+	 */
 	void SendMCPMessage(const MessageBase& InMessage,
 		const std::optional<std::vector<ConnectionID>>& InConnections = std::nullopt) const;
 
+	// Choose how inbound requests and notifications are scheduled; call before connecting. False once connected.
+	bool SetDispatchOptions(const MessageDispatchOptions& InOptions) const
+	{
+		return m_MessageManager->SetDispatchOptions(InOptions);
+	}
+
+	/**
+	 * How long an outgoing request waits for its response. On expiry the awaiting coroutine resumes with a
+	 * RequestTimeout error and the peer is sent notifications/cancelled. Zero waits forever.
+	 */
+	void SetRequestTimeout(const std::chrono::milliseconds InTimeout) { m_RequestTimeout = InTimeout; }
+	[[nodiscard]] std::chrono::milliseconds GetRequestTimeout() const { return m_RequestTimeout; }
+
 	void SetServerInfo(const Implementation& InServerInfo) { m_ServerInfo = InServerInfo; }
 	void SetClientInfo(const Implementation& InClientInfo) { m_ClientInfo = InClientInfo; }
 	void SetServerCapabilities(const ServerCapabilities& InServerCapabilities)
@@ -81,7 +116,7 @@ public:
 	// Response Task
 	template <ConcreteResponse T> struct ResponseTask
 	{
-		struct promise_type
+		struct promise_type : PooledFrame
 		{
 			JSONData m_RawResponse;
 			mutable std::unique_ptr<T> m_Response;
@@ -165,33 +200,75 @@ public:
 		// Should the coroutine continue or suspend? If "false", suspend
 		[[nodiscard]] bool await_ready() const noexcept { return !m_Handle || m_Handle.done(); }
 
-		// On Coroutine Suspend
-		void await_suspend(std::coroutine_handle<> InAwaiter)
+		// On Coroutine Suspend. A request that cannot be sent completes at once with an InternalError.
+		bool await_suspend(std::coroutine_handle<> InAwaiter)
 		{
 			if (!m_Transport->IsConnected())
 			{
 				HandleRuntimeError("Transport not connected");
-				return;
+				m_Handle.promise().SetRawResponse(
+					ErrorInternalError(m_Request->GetRequestID(), "Transport not connected"));
+				return false;
 			}
 
+			m_Awaiter = InAwaiter;
 			m_MessageManager->RegisterResponseHandler<T>(m_Request->GetRequestID(),
-				[Handle = this->m_Handle, InAwaiter](const JSONData& InRawResponse) mutable
+				[State = m_State, Handle = this->m_Handle, InAwaiter](const JSONData& InRawResponse)
 				{
-					if (Handle && !Handle.done())
+					// The awaiting coroutine runs on until it next suspends, which must not hold up a reactor loop
+					if (IOReactor::IsLoopThread())
 					{
-						Handle.promise().SetRawResponse(InRawResponse);
-						InAwaiter.resume();
+						ThreadPool::Shared().Post([State, Handle, InAwaiter, InRawResponse]
+							{ Complete(*State, Handle, InAwaiter, InRawResponse); });
+						return;
 					}
+					Complete(*State, Handle, InAwaiter, InRawResponse);
 				});
 
-			// TODO: @HalcyonOmega - Update with support for sending to specific connections
-			m_Transport->TransmitMessage(*m_Request, std::nullopt);
+			if (m_Timers && m_Timeout > std::chrono::milliseconds::zero())
+			{
+				m_TimerID = m_Timers->Schedule(m_Timeout,
+					[Manager = m_MessageManager,
+						Transport = m_Transport,
+						Connections = m_Connections,
+						ID = m_Request->GetRequestID(),
+						IsCancellable = m_Request->GetRequestMethod() != InitializeRequest::METHOD,
+						State = m_State,
+						Handle = this->m_Handle,
+						InAwaiter]
+					{
+						// Whichever of the response and the timeout takes the handler completes the request
+						if (!Manager->UnregisterResponseHandler(ID))
+						{
+							return;
+						}
+
+						// A client must not cancel its initialize request
+						if (IsCancellable)
+						{
+							Transport->TransmitMessage(
+								CancelledNotification{ CancelledNotification::Params{ ID, "Request timed out" } },
+								Connections);
+						}
+
+						// Resume off the timer thread so the awaiting coroutine cannot hold up other timeouts
+						ThreadPool::Shared().Post([State, Handle, InAwaiter, ID]
+							{ Complete(*State, Handle, InAwaiter, ErrorRequestTimeout(ID, "Request timed out")); });
+					});
+			}
+
+			m_Transport->TransmitMessage(*m_Request, m_Connections);
+			return true;
 		}
 
 		// On Coroutine Resume
 		[[nodiscard]] promise_type& await_resume() const
 		{
 			m_MessageManager->UnregisterResponseHandler(m_Request->GetRequestID());
+			if (m_Timers)
+			{
+				m_Timers->Cancel(m_TimerID);
+			}
 
 			if (m_Handle.promise().m_Exception)
 			{
@@ -201,89 +278,272 @@ public:
 			return m_Handle.promise();
 		}
 
+		/**
+		 * Give up on a request that is still waiting for its response. The awaiting coroutine resumes on the calling
+		 * thread with a RequestCancelled error, and the peer is sent notifications/cancelled.
+		 * @return False if the request was not in flight, or a response or timeout already completed it
+		 */
+		bool Cancel(const std::string_view InReason = "Request cancelled")
+		{
+			if (!m_MessageManager || !m_MessageManager->UnregisterResponseHandler(m_Request->GetRequestID()))
+			{
+				return false;
+			}
+			if (m_Timers)
+			{
+				m_Timers->Cancel(m_TimerID);
+			}
+
+			// A client must not cancel its initialize request
+			if (m_Request->GetRequestMethod() != InitializeRequest::METHOD)
+			{
+				m_Transport->TransmitMessage(
+					CancelledNotification{ CancelledNotification::Params{ m_Request->GetRequestID(),
+						std::string{ InReason } } },
+					m_Connections);
+			}
+
+			return Complete(*m_State,
+				m_Handle,
+				m_Awaiter,
+				ErrorRequestCancelled(m_Request->GetRequestID(), InReason));
+		}
+
 		void SetDependencies(std::unique_ptr<RequestBase> InRequest,
 			std::shared_ptr<ITransport> InTransport,
-			std::shared_ptr<MessageManager> InMessageManager)
+			std::shared_ptr<MessageManager> InMessageManager,
+			std::shared_ptr<TimerWheel> InTimers,
+			const std::chrono::milliseconds InTimeout,
+			std::optional<std::vector<ConnectionID>> InConnections)
 		{
 			m_Request = std::move(InRequest);
+			if (InConnections && InConnections->size() == 1)
+			{
+				m_State->Connection = InConnections->front();
+			}
+			m_Connections = std::move(InConnections);
 			m_Transport = std::move(InTransport);
 			m_MessageManager = std::move(InMessageManager);
+			m_Timers = std::move(InTimers);
+			m_Timeout = InTimeout;
 		}
 
-		~ResponseTask()
-		{
-			if (m_Handle)
-			{
-				m_Handle.destroy();
-			}
-		}
+		~ResponseTask() { Abandon(); }
 
-		// Non-copyable, movable
+		// Non-copyable, movable. Moving hands an in-flight request over as is: its response handler and timer refer
+		// to the coroutine frame, the awaiter and the completion state, never to the task object.
 		ResponseTask(const ResponseTask&) = delete;
 		ResponseTask(ResponseTask&& Other) noexcept
 			: m_Handle{ std::exchange(Other.m_Handle, {}) },
+			  m_State{ std::move(Other.m_State) },
 			  m_Transport{ std::move(Other.m_Transport) },
 			  m_MessageManager{ std::move(Other.m_MessageManager) },
-			  m_Request{ std::move(Other.m_Request) }
+			  m_Request{ std::move(Other.m_Request) },
+			  m_Connections{ std::move(Other.m_Connections) },
+			  m_Timers{ std::move(Other.m_Timers) },
+			  m_Timeout{ Other.m_Timeout },
+			  m_TimerID{ std::exchange(Other.m_TimerID, TimerWheel::INVALID_TIMER) },
+			  m_Awaiter{ std::exchange(Other.m_Awaiter, {}) }
 		{}
 		ResponseTask& operator=(const ResponseTask&) = delete;
 		ResponseTask& operator=(ResponseTask&& Other) noexcept
 		{
 			if (this != &Other)
 			{
-				if (m_Handle)
-					m_Handle.destroy();
+				Abandon();
 				m_Handle = std::exchange(Other.m_Handle, {});
+				m_State = std::move(Other.m_State);
 				m_Request = std::move(Other.m_Request);
+				m_Connections = std::move(Other.m_Connections);
 				m_Transport = std::move(Other.m_Transport);
 				m_MessageManager = std::move(Other.m_MessageManager);
+				m_Timers = std::move(Other.m_Timers);
+				m_Timeout = Other.m_Timeout;
+				m_TimerID = std::exchange(Other.m_TimerID, TimerWheel::INVALID_TIMER);
+				m_Awaiter = std::exchange(Other.m_Awaiter, {});
 			}
 			return *this;
 		}
 
 	private:
+		enum class ECompletion : uint8_t
+		{
+			Pending,
+			Completing, // The response is being handed over and the awaiter resumed
+			Completed,
+			Abandoned
+		};
+
+		/**
+		 * Shared with the jobs that complete the request from other threads. Completing and abandoning exclude each
+		 * other: once the task is abandoned a completion leaves the frame and the awaiter alone, and Abandon waits
+		 * out a completion that is already resuming the awaiter.
+		 */
+		struct CompletionState
+		{
+			std::atomic<ECompletion> Phase{ ECompletion::Pending };
+			// The thread resuming the awaiter, which may abandon the task itself from inside that resumption
+			std::atomic<std::thread::id> Completer;
+			// The session being served when the request was sent, installed again for the awaiter once it resumes
+			std::optional<ConnectionID> Connection;
+		};
+
 		// ====================================================================
 		// RESPONSE TASK MEMBERS
 		// ====================================================================
 		std::coroutine_handle<promise_type> m_Handle;
+		std::shared_ptr<CompletionState> m_State;
 		std::shared_ptr<ITransport> m_Transport;
 		std::shared_ptr<MessageManager> m_MessageManager;
 		std::unique_ptr<RequestBase> m_Request;
+		// The session the request and its cancellation go to; empty for every session, or the only peer
+		std::optional<std::vector<ConnectionID>> m_Connections;
+		std::shared_ptr<TimerWheel> m_Timers;
+		std::chrono::milliseconds m_Timeout{ 0 };
+		TimerWheel::TimerID m_TimerID{ TimerWheel::INVALID_TIMER };
+		std::coroutine_handle<> m_Awaiter;
+
+		explicit ResponseTask(const std::coroutine_handle<promise_type> Handle)
+			: m_Handle{ Handle },
+			  m_State{ std::make_shared<CompletionState>() }
+		{}
 
-		explicit ResponseTask(const std::coroutine_handle<promise_type> Handle) : m_Handle{ Handle } {}
+		/**
+		 * Hand the response to the frame and resume the awaiter, unless the task was abandoned or completed first.
+		 * @return False if it was
+		 */
+		static bool Complete(CompletionState& InState,
+			const std::coroutine_handle<promise_type> InHandle,
+			const std::coroutine_handle<> InAwaiter,
+			const JSONData& InRawResponse)
+		{
+			ECompletion Expected{ ECompletion::Pending };
+			if (!InState.Phase.compare_exchange_strong(Expected, ECompletion::Completing))
+			{
+				return false;
+			}
+			InState.Completer = std::this_thread::get_id();
+
+			if (InHandle && !InHandle.done())
+			{
+				InHandle.promise().SetRawResponse(InRawResponse);
+				// The thread resuming it may be serving another session, or none; replies must still reach this one
+				const MessageContext::Scope Context(InState.Connection);
+				InAwaiter.resume();
+			}
+
+			InState.Phase = ECompletion::Completed;
+			InState.Phase.notify_all();
+			return true;
+		}
+
+		/**
+		 * Withdraw a request still in flight, so a late response or timeout cannot resume a destroyed awaiter.
+		 * A completion that has not started yet finds the task abandoned and drops the response. One that has is
+		 * waited for, unless the awaiter it resumed is what is abandoning the task.
+		 */
+		void Abandon()
+		{
+			if (m_State)
+			{
+				ECompletion Phase{ ECompletion::Pending };
+				if (!m_State->Phase.compare_exchange_strong(Phase, ECompletion::Abandoned)
+					&& Phase == ECompletion::Completing && m_State->Completer.load() != std::this_thread::get_id())
+				{
+					m_State->Phase.wait(ECompletion::Completing);
+				}
+			}
+			if (m_MessageManager && m_Request)
+			{
+				m_MessageManager->UnregisterResponseHandler(m_Request->GetRequestID());
+			}
+			if (m_Timers)
+			{
+				m_Timers->Cancel(m_TimerID);
+			}
+			m_TimerID = TimerWheel::INVALID_TIMER;
+			if (m_Handle)
+			{
+				m_Handle.destroy();
+				m_Handle = {};
+			}
+		}
 
 		friend class MCPProtocol;
 	};
 
-	template <ConcreteResponse T> [[nodiscard]] ResponseTask<T> SendRequest(RequestBase&& InRequest)
+	/**
+	 * Taken by its concrete type, so the request keeps its params when it is stored for sending.
+	 * @param InTimeout Overrides the request timeout for this request alone
+	 */
+	template <ConcreteResponse T, std::derived_from<RequestBase> TRequest>
+	[[nodiscard]] ResponseTask<T> SendRequest(TRequest InRequest,
+		const std::optional<std::chrono::milliseconds> InTimeout = std::nullopt)
 	{
+		if (!InRequest.ID.IsAssigned())
+		{
+			InRequest.ID = m_MessageManager->AllocateRequestID();
+		}
+
 		// Create promise & handle for coroutine
 		auto InternalCoro = []() -> ResponseTask<T> { co_return; };
 
 		// Create a task object with a valid handle
 		ResponseTask<T> Task = InternalCoro();
 
+		// A request issued while a handler runs goes to the session being served, as the handler's replies do
+		std::optional<std::vector<ConnectionID>> Connections;
+		if (const std::optional<ConnectionID>& Current = MessageContext::GetConnectionID())
+		{
+			Connections.emplace({ *Current });
+		}
+
 		// Populate dependencies for coroutine to execute message sending
-		Task.SetDependencies(std::make_unique<std::decay_t<decltype(InRequest)>>(std::move(InRequest)),
+		Task.SetDependencies(std::make_unique<TRequest>(std::move(InRequest)),
 			m_Transport,
-			m_MessageManager);
+			m_MessageManager,
+			m_RequestTimers,
+			InTimeout.value_or(m_RequestTimeout),
+			std::move(Connections));
 
 		// Return a task which is fully prepped for co_await
 		return Task;
 	}
 
 protected:
+	// The first binary encoding listed by the peer that the transport can also switch to, if there is one
+	[[nodiscard]] std::optional<EWireFormat> SelectWireFormat(
+		const std::optional<ExperimentalCapability>& InPeerCapability) const;
+
 	EProtocolState m_State;
 	std::shared_ptr<ITransport> m_Transport;
 	std::shared_ptr<MessageManager> m_MessageManager;
+	// Expires requests whose response never arrives, so their handlers do not pile up
+	std::shared_ptr<TimerWheel> m_RequestTimers;
+	std::chrono::milliseconds m_RequestTimeout{ DEFAULT_REQUEST_TIMEOUT };
 
 	Implementation m_ServerInfo;
 	Implementation m_ClientInfo;
 	ServerCapabilities m_ServerCapabilities;
 	ClientCapabilities m_ClientCapabilities;
 
+	// Declared last so spawned tasks are joined before the members they use are destroyed. Subclasses whose own
+	// members are used by spawned tasks join it in their destructor.
+	TaskScope m_Tasks;
+
 private:
-	void SetupTransportRouter() const;
+	void SetupTransportRouter();
+	/**
+	 * Handle the elements of a JSON-RPC batch and answer with a single batch of responses.
+	 * Only responses sent while a handler runs on the thread that received its element are gathered. A handler that
+	 * suspends and replies later, from another thread, has its reply sent on its own after the batch reply. It
+	 * reaches the batch's session when the handler resumes from a request of its own; a transport serving many
+	 * sessions drops a reply that names none rather than show it to every session.
+	 */
+	void RouteBatch(InboundMessage InBatch, const std::optional<ConnectionID>& InConnectionID) const;
+	// RouteBatch waits for the pool to handle the elements, so a batch read on a reactor loop thread is moved off it
+	VoidTask RouteBatchOnPool(InboundMessage InBatch, std::optional<ConnectionID> InConnectionID) const;
+	[[nodiscard]] static bool IsSessionScoped(const MessageBase& InMessage);
 };
 
 MCP_NAMESPACE_END
@@ -15,12 +15,15 @@ public:
 		const std::optional<std::unique_ptr<TransportOptions>>& InOptions,
 		const Implementation& InClientInfo,
 		const ClientCapabilities& InCapabilities);
+	// Joins spawned tasks while the handlers they may use are still alive
+	~MCPClient() override;
 
 	VoidTask Start() override;
 	VoidTask Stop() override;
 
-	// Initialization
-	OptTask<InitializeResponse::Result> Request_Initialize(const InitializeRequest::Params& InParams);
+	// Initialization. InTimeout bounds the handshake in place of the request timeout.
+	OptTask<InitializeResponse::Result> Request_Initialize(const InitializeRequest::Params& InParams,
+		std::optional<std::chrono::milliseconds> InTimeout = std::nullopt);
 	// Tools
 	OptTask<ListToolsResponse::Result> Request_ListTools(const PaginatedRequestParams& InParams);
 	OptTask<CallToolResponse::Result> Request_CallTool(const CallToolRequest::Params& InParams);
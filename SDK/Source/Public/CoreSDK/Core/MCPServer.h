@@ -21,6 +21,8 @@ public:
 		const std::optional<std::unique_ptr<TransportOptions>>& InOptions,
 		const Implementation& InServerInfo,
 		const ServerCapabilities& InCapabilities);
+	// Joins spawned tasks while the handlers they may use are still alive
+	~MCPServer() override;
 
 	// Lifecycle methods
 	VoidTask Start() override;
@@ -122,7 +124,7 @@ private:
 
 	// Resource subscription management
 	void Notify_ResourceSubscribers(const ResourceUpdatedNotification::Params& InParams);
-	std::string_view GetCurrentClientID() const;
+	[[nodiscard]] std::string GetCurrentClientID() const;
 
 	VoidTask UpdateProgress(double InProgress, std::optional<int64_t> InTotal = {});
 	VoidTask CompleteProgress();
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "CoreSDK/Core/MCPClient.h"
+#include "CoreSDK/Transport/ITransport.h"
+
+MCP_NAMESPACE_BEGIN
+
+struct StdioProcessPoolOptions
+{
+	static constexpr std::size_t DEFAULT_POOL_SIZE{ 4 };
+	static constexpr std::chrono::milliseconds DEFAULT_HEALTH_CHECK_INTERVAL{ 10000 };
+	static constexpr std::chrono::milliseconds DEFAULT_INITIALIZE_TIMEOUT{ 10000 };
+	static constexpr std::chrono::milliseconds DEFAULT_HEALTH_CHECK_TIMEOUT{ 2000 };
+
+	// Idle children kept ready per server
+	std::size_t PoolSize{ DEFAULT_POOL_SIZE };
+	// How often idle children are pinged
+	std::chrono::milliseconds HealthCheckInterval{ DEFAULT_HEALTH_CHECK_INTERVAL };
+	// Request timeouts for the pool's own handshakes and pings; zero waits forever
+	std::chrono::milliseconds InitializeTimeout{ DEFAULT_INITIALIZE_TIMEOUT };
+	std::chrono::milliseconds HealthCheckTimeout{ DEFAULT_HEALTH_CHECK_TIMEOUT };
+	Implementation ClientInfo;
+	ClientCapabilities Capabilities;
+};
+
+struct StdioProcessPoolStats
+{
+	uint64_t Hits{ 0 };					// Acquisitions served by a prewarmed child
+	uint64_t Misses{ 0 };				// Acquisitions that had to launch a child on the caller's thread
+	uint64_t Launched{ 0 };				// Children launched and initialized successfully
+	uint64_t LaunchFailures{ 0 };		// Children that failed to launch or initialize in time
+	uint64_t Recycled{ 0 };				// Children stopped after serving their session
+	uint64_t HealthCheckFailures{ 0 };	// Children found dead or unresponsive to a ping
+	std::size_t Idle{ 0 };
+	std::size_t InUse{ 0 };
+};
+
+class StdioProcessPool;
+
+/**
+ * A session on a pooled child process. The client is already connected and initialized; destroying the lease stops
+ * the child, and the pool launches a fresh one in its place.
+ */
+class StdioProcessLease
+{
+public:
+	StdioProcessLease() = default;
+	~StdioProcessLease();
+	StdioProcessLease(const StdioProcessLease&) = delete;
+	StdioProcessLease& operator=(const StdioProcessLease&) = delete;
+	StdioProcessLease(StdioProcessLease&& Other) noexcept;
+	StdioProcessLease& operator=(StdioProcessLease&& Other) noexcept;
+
+	[[nodiscard]] MCPClient* Get() const { return m_Client.get(); }
+	MCPClient* operator->() const { return m_Client.get(); }
+	explicit operator bool() const { return m_Client != nullptr; }
+
+	// End the session before the lease goes out of scope
+	void Release();
+
+private:
+	friend class StdioProcessPool;
+
+	StdioProcessLease(StdioProcessPool* InPool, std::string InKey, std::shared_ptr<MCPClient> InClient);
+
+	StdioProcessPool* m_Pool{ nullptr };
+	std::string m_Key;
+	std::shared_ptr<MCPClient> m_Client;
+};
+
+/**
+ * Keeps launched and initialized stdio servers ready so sessions skip process start-up and the initialize handshake.
+ * Children are pooled per command line. A child serves exactly one session: neither MCP nor the server promises that
+ * a second initialize resets what the first session left behind, and the client keeps the handlers its lessee
+ * registered, so a child is stopped when its lease ends and only children that were never leased are handed out.
+ * A maintenance thread tops each pool up to PoolSize, pings idle children every HealthCheckInterval and retires
+ * children that have gone away or stop answering.
+ * The pool must outlive every lease it hands out.
+ */
+class StdioProcessPool
+{
+public:
+	explicit StdioProcessPool(StdioProcessPoolOptions InOptions);
+	~StdioProcessPool() noexcept;
+	StdioProcessPool(const StdioProcessPool&) = delete;
+	StdioProcessPool(StdioProcessPool&&) = delete;
+	StdioProcessPool& operator=(const StdioProcessPool&) = delete;
+	StdioProcessPool& operator=(StdioProcessPool&&) = delete;
+
+	/**
+	 * Start keeping children ready for a server ahead of the first Acquire().
+	 * @param InServer The command line to pool
+	 */
+	void Prewarm(const StdioClientTransportOptions& InServer);
+
+	/**
+	 * Take an initialized client for a server. An idle child is handed out immediately; otherwise one is launched
+	 * and initialized on the calling thread.
+	 * @param InServer The command line to run
+	 * @return The lease, empty if no child could be started
+	 */
+	[[nodiscard]] StdioProcessLease Acquire(const StdioClientTransportOptions& InServer);
+
+	[[nodiscard]] StdioProcessPoolStats GetStats() const;
+
+private:
+	friend class StdioProcessLease;
+
+	struct ServerPool
+	{
+		StdioClientTransportOptions Server;
+		std::deque<std::shared_ptr<MCPClient>> Idle; // Initialized and never leased
+		std::size_t InUse{ 0 };
+		std::size_t Warming{ 0 }; // Children being launched or pinged
+	};
+
+	static std::string MakeKey(const StdioClientTransportOptions& InServer);
+
+	ServerPool& FindOrAddPool(const std::string& InKey, const StdioClientTransportOptions& InServer);
+	void Return(const std::string& InKey, std::shared_ptr<MCPClient> InClient);
+	[[nodiscard]] std::shared_ptr<MCPClient> Launch(const StdioClientTransportOptions& InServer);
+	[[nodiscard]] bool Ping(MCPClient& InClient) const;
+	// Put a child that was pinged back into service, or retire it
+	void Restore(ServerPool& InPool, std::shared_ptr<MCPClient> InClient, bool InIsHealthy);
+	void Retire(std::shared_ptr<MCPClient> InClient) const;
+	void MaintenanceLoop(const std::stop_token& InStopToken);
+
+	StdioProcessPoolOptions m_Options;
+
+	mutable std::mutex m_Mutex;
+	std::condition_variable_any m_Wake;
+	std::unordered_map<std::string, ServerPool> m_Pools;
+	std::vector<std::shared_ptr<MCPClient>> m_Retiring;
+	bool m_NeedsMaintenance{ false };
+	std::chrono::steady_clock::time_point m_LastHealthCheck{ std::chrono::steady_clock::now() };
+	StdioProcessPoolStats m_Stats;
+
+	std::jthread m_MaintenanceThread;
+};
+
+MCP_NAMESPACE_END
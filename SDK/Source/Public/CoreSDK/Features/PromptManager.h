@@ -9,6 +9,7 @@
 #include "CoreSDK/Common/Macros.h"
 #include "CoreSDK/Messages/MCPMessages.h"
 #include "PromptBase.h"
+#include "Utilities/JSON/SerializedCache.h"
 
 MCP_NAMESPACE_BEGIN
 
@@ -56,6 +57,12 @@ public:
 	 */
 	ListPromptsResponse::Result ListPrompts(const PaginatedRequestParams* InRequest) const;
 
+	/**
+	 * The prompts/list result, serialized once and shared until a prompt is added or removed.
+	 * @return Text of a ListPromptsResponse::Result
+	 */
+	SerializedCache::Text GetSerializedPromptList() const;
+
 	/**
 	 * Check if a prompt with the given name exists.
 	 * @param InName The name to check
@@ -67,6 +74,10 @@ private:
 	std::map<Prompt, PromptFunction> m_Prompts;
 	bool m_WarnOnDuplicatePrompts;
 	mutable std::mutex m_Mutex;
+	mutable SerializedCache m_ListCache;
+
+	// Copy of every registered prompt; the caller holds m_Mutex
+	std::vector<Prompt> SnapshotPrompts() const;
 };
 
 MCP_NAMESPACE_END
\ No newline at end of file
@@ -7,11 +7,13 @@
 #include <string>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include "CoreSDK/Common/Content.h"
 #include "CoreSDK/Common/Macros.h"
 #include "CoreSDK/Messages/MCPMessages.h"
 #include "ResourceBase.h"
+#include "Utilities/JSON/SerializedCache.h"
 
 MCP_NAMESPACE_BEGIN
 
@@ -78,6 +80,12 @@ public:
 	 */
 	ListResourceTemplatesResponse::Result ListTemplates(const PaginatedRequestParams* InRequest);
 
+	/**
+	 * The resources/list result, serialized once and shared until a resource is added or removed.
+	 * @return Text of a ListResourcesResponse::Result
+	 */
+	SerializedCache::Text GetSerializedResourceList() const;
+
 	/**
 	 * Check if a resource with the given URI exists.
 	 * @param InURI The URI to check
@@ -96,16 +104,21 @@ private:
 	std::unordered_map<std::string, std::pair<ResourceTemplate, ResourceFunction>> m_Templates;
 	bool m_WarnOnDuplicateResources;
 	mutable std::mutex m_Mutex;
+	mutable SerializedCache m_ListCache;
 
 	std::unordered_map<std::string /* Resource */, std::vector<std::string> /* Connections */> m_ResourceSubscriptions;
 	mutable std::mutex m_ResourceSubscriptionsMutex;
 
+	// Copy of every registered resource; the caller holds m_Mutex
+	std::vector<Resource> SnapshotResources() const;
+
 	/**
 	 * Check if a URI matches a template and extract parameters.
 	 * @param InTemplate The template to match against
 	 * @param InURI The URI to match
 	 * @return Optional map of template parameters if matched
 	 */
+
 	static std::optional<std::unordered_map<std::string, std::string>> MatchTemplate(const ResourceTemplate& InTemplate,
 		const MCP::URI& InURI);
 };
@@ -6,11 +6,13 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "CoreSDK/Common/Macros.h"
 #include "CoreSDK/Messages/MCPMessages.h"
 #include "JSONProxy.h"
 #include "ToolBase.h"
+#include "Utilities/JSON/SerializedCache.h"
 
 // Forward declarations
 class MCPContext;
@@ -81,10 +83,20 @@ public:
 	 */
 	ListToolsResponse::Result ListTools(const PaginatedRequestParams* InRequest) const;
 
+	/**
+	 * The tools/list result, serialized once and shared until a tool is added or removed.
+	 * @return Text of a ListToolsResponse::Result
+	 */
+	SerializedCache::Text GetSerializedToolList() const;
+
 private:
 	std::map<Tool, ToolFunction> m_Tools;
 	bool m_WarnOnDuplicateTools;
 	mutable std::mutex m_Mutex;
+	mutable SerializedCache m_ListCache;
+
+	// Copy of every registered tool; the caller holds m_Mutex
+	std::vector<Tool> SnapshotTools() const;
 
 	/**
 	 * Create a basic JSON schema for a tool.
@@ -6,6 +6,7 @@
 
 #include "CoreSDK/Messages/MessageBase.h"
 #include "CoreSDK/Messages/RequestBase.h"
+#include "CoreSDK/Messages/ResponseBase.h"
 #include "JSONProxy.h"
 
 MCP_NAMESPACE_BEGIN
@@ -18,7 +19,10 @@ enum class Errors : int64_t
 	MethodNotFound = -32601,
 	InvalidParams = -32602,
 	InternalError = -32603,
-	UnknownError = -32000
+	UnknownError = -32000,
+	RequestTimeout = -32001,
+	// Never sent: completes a request the SDK cancelled locally before its response arrived
+	RequestCancelled = -32800
 };
 
 struct FErrorData
@@ -50,7 +54,8 @@ struct ErrorResponseBase : ResponseBase
 
 	JSON_KEY(ERRORKEY, ErrorData, "error")
 
-	DEFINE_TYPE_JSON_DERIVED(ErrorResponseBase, ResponseBase, IDKEY, ERRORKEY)
+	// An error carries no result, so its JSON skips ResponseBase
+	DEFINE_TYPE_JSON_DERIVED(ErrorResponseBase, MessageBase, IDKEY, ERRORKEY)
 
 	ErrorResponseBase() = default;
 	~ErrorResponseBase() override = default;
@@ -102,4 +107,18 @@ inline ErrorResponseBase ErrorInternalError(RequestID InID,
 	return ErrorResponseBase{ std::move(InID), FErrorData(Errors::InternalError, InMessage, InData) };
 }
 
+inline ErrorResponseBase ErrorRequestTimeout(RequestID InID,
+	const std::string_view InMessage,
+	const std::optional<JSONData>& InData = std::nullopt)
+{
+	return ErrorResponseBase{ std::move(InID), FErrorData(Errors::RequestTimeout, InMessage, InData) };
+}
+
+inline ErrorResponseBase ErrorRequestCancelled(RequestID InID,
+	const std::string_view InMessage,
+	const std::optional<JSONData>& InData = std::nullopt)
+{
+	return ErrorResponseBase{ std::move(InID), FErrorData(Errors::RequestCancelled, InMessage, InData) };
+}
+
 MCP_NAMESPACE_END
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 
@@ -75,6 +76,8 @@ struct EmptyResponse : ResponseBase
  */
 struct InitializeRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "initialize" };
+
 	struct Params : RequestParams
 	{
 		EProtocolVersion ProtocolVersion{
@@ -107,9 +110,9 @@ struct InitializeRequest : RequestBase
 		{}
 	};
 
-	InitializeRequest() : RequestBase("initialize", std::make_unique<InitializeRequest::Params>()) {}
+	InitializeRequest() : RequestBase(METHOD, std::make_unique<InitializeRequest::Params>()) {}
 	explicit InitializeRequest(const InitializeRequest::Params& InParams)
-		: RequestBase("initialize", std::make_unique<InitializeRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<InitializeRequest::Params>(InParams))
 	{}
 };
 
@@ -224,7 +227,9 @@ struct InitializeResponse : ResponseBase
  */
 struct InitializedNotification : NotificationBase
 {
-	InitializedNotification() : NotificationBase("notifications/initialized") {}
+	static constexpr std::string_view METHOD{ "notifications/initialized" };
+
+	InitializedNotification() : NotificationBase(METHOD) {}
 };
 
 // PingRequest {
@@ -263,7 +268,9 @@ struct InitializedNotification : NotificationBase
  */
 struct PingRequest : RequestBase
 {
-	PingRequest() : RequestBase("ping") {}
+	static constexpr std::string_view METHOD{ "ping" };
+
+	PingRequest() : RequestBase(METHOD) {}
 };
 
 struct PingResponse : ResponseBase
@@ -296,9 +303,11 @@ struct PingResponse : ResponseBase
  */
 struct ListToolsRequest : RequestBase
 {
-	ListToolsRequest() : RequestBase("tools/list") {}
+	static constexpr std::string_view METHOD{ "tools/list" };
+
+	ListToolsRequest() : RequestBase(METHOD) {}
 	explicit ListToolsRequest(const PaginatedRequestParams& InParams)
-		: RequestBase("tools/list", std::make_unique<PaginatedRequestParams>(InParams))
+		: RequestBase(METHOD, std::make_unique<PaginatedRequestParams>(InParams))
 	{}
 };
 
@@ -379,6 +388,8 @@ struct ListToolsResponse : ResponseBase
  */
 struct CallToolRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "tools/call" };
+
 	struct Params : RequestParams
 	{
 		std::string Name;
@@ -399,9 +410,9 @@ struct CallToolRequest : RequestBase
 		{}
 	};
 
-	CallToolRequest() : RequestBase("tools/call") {}
+	CallToolRequest() : RequestBase(METHOD) {}
 	explicit CallToolRequest(const CallToolRequest::Params& InParams)
-		: RequestBase("tools/call", std::make_unique<CallToolRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<CallToolRequest::Params>(InParams))
 	{}
 };
 
@@ -509,7 +520,9 @@ struct CallToolResponse : ResponseBase
  */
 struct ToolListChangedNotification : NotificationBase
 {
-	ToolListChangedNotification() : NotificationBase("notifications/tools/list_changed") {}
+	static constexpr std::string_view METHOD{ "notifications/tools/list_changed" };
+
+	ToolListChangedNotification() : NotificationBase(METHOD) {}
 };
 
 // ListPromptsRequest {
@@ -541,9 +554,11 @@ struct ToolListChangedNotification : NotificationBase
  */
 struct ListPromptsRequest : RequestBase
 {
-	ListPromptsRequest() : RequestBase("prompts/list") {}
+	static constexpr std::string_view METHOD{ "prompts/list" };
+
+	ListPromptsRequest() : RequestBase(METHOD) {}
 	explicit ListPromptsRequest(const PaginatedRequestParams& InParams)
-		: RequestBase("prompts/list", std::make_unique<PaginatedRequestParams>(InParams))
+		: RequestBase(METHOD, std::make_unique<PaginatedRequestParams>(InParams))
 	{}
 };
 
@@ -631,6 +646,8 @@ struct ListPromptsResponse : ResponseBase
  */
 struct GetPromptRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "prompts/get" };
+
 	struct Params : RequestParams
 	{
 		std::string Name; // The name of the prompt or prompt template.
@@ -653,9 +670,9 @@ struct GetPromptRequest : RequestBase
 		{}
 	};
 
-	GetPromptRequest() : RequestBase("prompts/get") {}
+	GetPromptRequest() : RequestBase(METHOD) {}
 	explicit GetPromptRequest(const GetPromptRequest::Params& InParams)
-		: RequestBase("prompts/get", std::make_unique<GetPromptRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<GetPromptRequest::Params>(InParams))
 	{}
 };
 
@@ -741,7 +758,9 @@ struct GetPromptResponse : ResponseBase
  */
 struct PromptListChangedNotification : NotificationBase
 {
-	PromptListChangedNotification() : NotificationBase("notifications/prompts/list_changed") {}
+	static constexpr std::string_view METHOD{ "notifications/prompts/list_changed" };
+
+	PromptListChangedNotification() : NotificationBase(METHOD) {}
 };
 
 // ListResourcesRequest {
@@ -768,9 +787,11 @@ struct PromptListChangedNotification : NotificationBase
  */
 struct ListResourcesRequest : RequestBase
 {
-	ListResourcesRequest() : RequestBase("resources/list") {}
+	static constexpr std::string_view METHOD{ "resources/list" };
+
+	ListResourcesRequest() : RequestBase(METHOD) {}
 	explicit ListResourcesRequest(const PaginatedRequestParams& InParams)
-		: RequestBase("resources/list", std::make_unique<PaginatedRequestParams>(InParams))
+		: RequestBase(METHOD, std::make_unique<PaginatedRequestParams>(InParams))
 	{}
 };
 
@@ -854,9 +875,11 @@ struct ListResourcesResponse : ResponseBase
  */
 struct ListResourceTemplatesRequest : RequestBase
 {
-	ListResourceTemplatesRequest() : RequestBase("resources/templates/list") {}
+	static constexpr std::string_view METHOD{ "resources/templates/list" };
+
+	ListResourceTemplatesRequest() : RequestBase(METHOD) {}
 	explicit ListResourceTemplatesRequest(const PaginatedRequestParams& InParams)
-		: RequestBase("resources/templates/list", std::make_unique<PaginatedRequestParams>(InParams))
+		: RequestBase(METHOD, std::make_unique<PaginatedRequestParams>(InParams))
 	{}
 };
 
@@ -948,6 +971,8 @@ struct ListResourceTemplatesResponse : ResponseBase
  */
 struct ResourceUpdatedNotification : NotificationBase
 {
+	static constexpr std::string_view METHOD{ "notifications/resources/updated" };
+
 	struct Params : NotificationParams
 	{
 		MCP::URI URI; // The URI of the resource that has been updated. This might be a
@@ -964,9 +989,9 @@ struct ResourceUpdatedNotification : NotificationBase
 		{}
 	};
 
-	ResourceUpdatedNotification() : NotificationBase("notifications/resources/updated") {}
+	ResourceUpdatedNotification() : NotificationBase(METHOD) {}
 	explicit ResourceUpdatedNotification(const ResourceUpdatedNotification::Params& InParams)
-		: NotificationBase("notifications/resources/updated",
+		: NotificationBase(METHOD,
 			  std::make_unique<ResourceUpdatedNotification::Params>(InParams))
 	{}
 };
@@ -997,6 +1022,8 @@ struct ResourceUpdatedNotification : NotificationBase
  */
 struct ReadResourceRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "resources/read" };
+
 	struct Params : RequestParams
 	{
 		MCP::URI URI; // The URI of the resource to read. The URI can use any
@@ -1013,9 +1040,9 @@ struct ReadResourceRequest : RequestBase
 		{}
 	};
 
-	ReadResourceRequest() : RequestBase("resources/read") {}
+	ReadResourceRequest() : RequestBase(METHOD) {}
 	explicit ReadResourceRequest(const ReadResourceRequest::Params& InParams)
-		: RequestBase("resources/read", std::make_unique<ReadResourceRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<ReadResourceRequest::Params>(InParams))
 	{}
 };
 
@@ -1105,6 +1132,8 @@ struct ReadResourceResponse : ResponseBase
  */
 struct SubscribeRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "resources/subscribe" };
+
 	struct Params : RequestParams
 	{
 		MCP::URI URI{}; // The URI of the resource to subscribe to. The URI can use
@@ -1121,9 +1150,9 @@ struct SubscribeRequest : RequestBase
 		{}
 	};
 
-	SubscribeRequest() : RequestBase("resources/subscribe") {}
+	SubscribeRequest() : RequestBase(METHOD) {}
 	explicit SubscribeRequest(const SubscribeRequest::Params& InParams)
-		: RequestBase("resources/subscribe", std::make_unique<SubscribeRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<SubscribeRequest::Params>(InParams))
 	{}
 };
 
@@ -1155,6 +1184,8 @@ struct SubscribeRequest : RequestBase
  */
 struct UnsubscribeRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "resources/unsubscribe" };
+
 	struct Params : RequestParams
 	{
 		MCP::URI URI{}; // The URI of the resource to unsubscribe from.
@@ -1170,9 +1201,9 @@ struct UnsubscribeRequest : RequestBase
 		{}
 	};
 
-	UnsubscribeRequest() : RequestBase("resources/unsubscribe") {}
+	UnsubscribeRequest() : RequestBase(METHOD) {}
 	explicit UnsubscribeRequest(const UnsubscribeRequest::Params& InParams)
-		: RequestBase("resources/unsubscribe", std::make_unique<UnsubscribeRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<UnsubscribeRequest::Params>(InParams))
 	{}
 };
 
@@ -1214,7 +1245,9 @@ struct UnsubscribeRequest : RequestBase
  */
 struct ResourceListChangedNotification : NotificationBase
 {
-	ResourceListChangedNotification() : NotificationBase("notifications/resources/list_changed") {}
+	static constexpr std::string_view METHOD{ "notifications/resources/list_changed" };
+
+	ResourceListChangedNotification() : NotificationBase(METHOD) {}
 };
 
 // CreateMessageRequest {
@@ -1277,6 +1310,8 @@ struct ResourceListChangedNotification : NotificationBase
  */
 struct CreateMessageRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "sampling/createMessage" };
+
 	struct Params : RequestParams
 	{
 		std::vector<SamplingMessage> Messages;
@@ -1354,9 +1389,9 @@ struct CreateMessageRequest : RequestBase
 		}
 	};
 
-	CreateMessageRequest() : RequestBase("sampling/create_message") {}
+	CreateMessageRequest() : RequestBase(METHOD) {}
 	explicit CreateMessageRequest(const CreateMessageRequest::Params& InParams)
-		: RequestBase("sampling/createMessage", std::make_unique<CreateMessageRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<CreateMessageRequest::Params>(InParams))
 	{}
 };
 
@@ -1483,9 +1518,11 @@ struct CreateMessageResponse : ResponseBase
  */
 struct ListRootsRequest : RequestBase
 {
-	ListRootsRequest() : RequestBase("roots/list") {}
+	static constexpr std::string_view METHOD{ "roots/list" };
+
+	ListRootsRequest() : RequestBase(METHOD) {}
 	explicit ListRootsRequest(const PaginatedRequestParams& InParams)
-		: RequestBase("roots/list", std::make_unique<PaginatedRequestParams>(InParams))
+		: RequestBase(METHOD, std::make_unique<PaginatedRequestParams>(InParams))
 	{}
 };
 
@@ -1580,7 +1617,9 @@ struct ListRootsResponse : ResponseBase
  */
 struct RootsListChangedNotification : NotificationBase
 {
-	RootsListChangedNotification() : NotificationBase("notifications/roots/list_changed") {}
+	static constexpr std::string_view METHOD{ "notifications/roots/list_changed" };
+
+	RootsListChangedNotification() : NotificationBase(METHOD) {}
 };
 
 // SetLevelRequest {
@@ -1609,6 +1648,8 @@ struct RootsListChangedNotification : NotificationBase
  */
 struct SetLevelRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "logging/setLevel" };
+
 	struct Params : RequestParams
 	{
 		ELoggingLevel Level{ ELoggingLevel::Unknown }; // The level of logging that the client wants to receive
@@ -1627,9 +1668,9 @@ struct SetLevelRequest : RequestBase
 		{}
 	};
 
-	SetLevelRequest() : RequestBase("logging/setLevel") {}
+	SetLevelRequest() : RequestBase(METHOD) {}
 	explicit SetLevelRequest(const SetLevelRequest::Params& InParams)
-		: RequestBase("logging/setLevel", std::make_unique<SetLevelRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<SetLevelRequest::Params>(InParams))
 	{}
 };
 
@@ -1671,6 +1712,8 @@ struct SetLevelRequest : RequestBase
  */
 struct LoggingMessageNotification : NotificationBase
 {
+	static constexpr std::string_view METHOD{ "notifications/message" };
+
 	struct Params : NotificationParams
 	{
 		ELoggingLevel Level{ ELoggingLevel::Unknown };	   // The severity of this log message.
@@ -1696,9 +1739,9 @@ struct LoggingMessageNotification : NotificationBase
 		{}
 	};
 
-	LoggingMessageNotification() : NotificationBase("notifications/message") {}
+	LoggingMessageNotification() : NotificationBase(METHOD) {}
 	explicit LoggingMessageNotification(const LoggingMessageNotification::Params& InParams)
-		: NotificationBase("notifications/message", std::make_unique<LoggingMessageNotification::Params>(InParams))
+		: NotificationBase(METHOD, std::make_unique<LoggingMessageNotification::Params>(InParams))
 	{}
 };
 
@@ -1746,6 +1789,8 @@ struct LoggingMessageNotification : NotificationBase
  */
 struct ProgressNotification : NotificationBase
 {
+	static constexpr std::string_view METHOD{ "notifications/progress" };
+
 	struct Params : NotificationParams
 	{
 		std::optional<std::string> Message{ std::nullopt }; // An optional message describing the current progress.
@@ -1783,9 +1828,9 @@ struct ProgressNotification : NotificationBase
 		{}
 	};
 
-	ProgressNotification() : NotificationBase("notifications/progress") {}
+	ProgressNotification() : NotificationBase(METHOD) {}
 	explicit ProgressNotification(const ProgressNotification::Params& InParams)
-		: NotificationBase("notifications/progress", std::make_unique<ProgressNotification::Params>(InParams))
+		: NotificationBase(METHOD, std::make_unique<ProgressNotification::Params>(InParams))
 	{}
 };
 
@@ -1831,6 +1876,8 @@ struct ProgressNotification : NotificationBase
  */
 struct CancelledNotification : NotificationBase
 {
+	static constexpr std::string_view METHOD{ "notifications/cancelled" };
+
 	struct Params : NotificationParams
 	{
 		RequestID CancelRequestID;						   // The ID of the request to cancel. This MUST
@@ -1854,9 +1901,9 @@ struct CancelledNotification : NotificationBase
 		{}
 	};
 
-	CancelledNotification() : NotificationBase("notifications/cancelled") {}
+	CancelledNotification() : NotificationBase(METHOD) {}
 	explicit CancelledNotification(const CancelledNotification::Params& InParams)
-		: NotificationBase("notifications/cancelled", std::make_unique<CancelledNotification::Params>(InParams))
+		: NotificationBase(METHOD, std::make_unique<CancelledNotification::Params>(InParams))
 	{}
 };
 
@@ -1902,6 +1949,8 @@ struct CancelledNotification : NotificationBase
  */
 struct CompleteRequest : RequestBase
 {
+	static constexpr std::string_view METHOD{ "completion/complete" };
+
 	struct Params : RequestParams
 	{
 		std::variant<PromptReference, ResourceReference> Reference;
@@ -1938,9 +1987,9 @@ struct CompleteRequest : RequestBase
 		{}
 	};
 
-	CompleteRequest() : RequestBase("completion/complete") {}
+	CompleteRequest() : RequestBase(METHOD) {}
 	explicit CompleteRequest(const CompleteRequest::Params& InParams)
-		: RequestBase("completion/complete", std::make_unique<CompleteRequest::Params>(InParams))
+		: RequestBase(METHOD, std::make_unique<CompleteRequest::Params>(InParams))
 	{}
 };
 
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "CoreSDK/Common/Macros.h"
 #include "JSONProxy.h"
+#include "Utilities/JSON/JSONWriter.h"
 
 MCP_NAMESPACE_BEGIN
 
@@ -14,7 +16,7 @@ struct MessageBase
 
 	JSON_KEY(JSONRPCKEY, JSONRPC, "jsonrpc")
 
-	DEFINE_TYPE_JSON(MessageBase, JSONRPCKEY)
+	DEFINE_TYPE_JSON_POLYMORPHIC(MessageBase, JSONRPCKEY)
 
 	virtual ~MessageBase() = default;
 	MessageBase() = default;
@@ -28,4 +30,21 @@ struct MessageBase
 template <typename T>
 concept ConcreteMessage = std::is_base_of_v<MessageBase, T>;
 
+/**
+ * Serialize a message, as its dynamic type, straight into OutBuffer between a transport's framing, such as "data: "
+ * and "\n\n" for an event stream. OutBuffer is cleared but keeps its capacity, so reusing one buffer across messages
+ * avoids reallocating it.
+ */
+inline void WriteFramedMessage(const MessageBase& InMessage,
+	std::string& OutBuffer,
+	const std::string_view InPrefix = {},
+	const std::string_view InSuffix = {})
+{
+	OutBuffer.clear();
+	OutBuffer.append(InPrefix);
+	JSONWriter Writer(OutBuffer);
+	InMessage.SerializeTo(Writer);
+	OutBuffer.append(InSuffix);
+}
+
 MCP_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "JSONProxy.h"
+
+MCP_NAMESPACE_BEGIN
+
+// Gathers the responses to the elements of a JSON-RPC batch so they can be sent back as one batch. Only replies sent
+// from within a BatchScope reach it.
+class BatchCollector
+{
+public:
+	void Add(JSONData InResponse)
+	{
+		std::lock_guard Lock(m_Mutex);
+		m_Responses.emplace_back(std::move(InResponse));
+	}
+
+	[[nodiscard]] std::vector<JSONData> Take()
+	{
+		std::lock_guard Lock(m_Mutex);
+		return std::exchange(m_Responses, {});
+	}
+
+private:
+	std::mutex m_Mutex;
+	std::vector<JSONData> m_Responses;
+};
+
+/**
+ * The connection of the message currently being handled on this thread.
+ * Installed by the message router for the duration of a handler so replies can be addressed to the session the
+ * request came from without threading the connection through every handler signature.
+ */
+class MessageContext
+{
+public:
+	// Installs a connection for the current thread and restores the previous one when it goes out of scope
+	class Scope
+	{
+	public:
+		explicit Scope(std::optional<std::string> InConnectionID)
+			: m_Previous(std::exchange(CurrentConnectionID(), std::move(InConnectionID)))
+		{}
+		~Scope() noexcept { CurrentConnectionID() = std::move(m_Previous); }
+		Scope(const Scope&) = delete;
+		Scope(Scope&&) = delete;
+		Scope& operator=(const Scope&) = delete;
+		Scope& operator=(Scope&&) = delete;
+
+	private:
+		std::optional<std::string> m_Previous;
+	};
+
+	// Routes the responses sent on this thread into a batch reply while in scope
+	class BatchScope
+	{
+	public:
+		explicit BatchScope(BatchCollector* InBatch) : m_Previous(std::exchange(CurrentBatch(), InBatch)) {}
+		~BatchScope() noexcept { CurrentBatch() = m_Previous; }
+		BatchScope(const BatchScope&) = delete;
+		BatchScope(BatchScope&&) = delete;
+		BatchScope& operator=(const BatchScope&) = delete;
+		BatchScope& operator=(BatchScope&&) = delete;
+
+	private:
+		BatchCollector* m_Previous;
+	};
+
+	// Empty outside of a handler or when the transport has a single peer
+	[[nodiscard]] static const std::optional<std::string>& GetConnectionID() { return CurrentConnectionID(); }
+
+	// Null unless the current message is an element of a batch
+	[[nodiscard]] static BatchCollector* GetBatch() { return CurrentBatch(); }
+
+private:
+	static std::optional<std::string>& CurrentConnectionID()
+	{
+		thread_local std::optional<std::string> ConnectionID;
+		return ConnectionID;
+	}
+
+	static BatchCollector*& CurrentBatch()
+	{
+		thread_local BatchCollector* Batch{ nullptr };
+		return Batch;
+	}
+};
+
+MCP_NAMESPACE_END
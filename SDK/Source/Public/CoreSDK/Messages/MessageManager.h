@@ -1,26 +1,64 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 
 #include "CoreSDK/Common/RuntimeError.h"
 #include "CoreSDK/Messages/ErrorResponseBase.h"
+#include "CoreSDK/Messages/MessageContext.h"
+#include "CoreSDK/Messages/MethodTable.h"
 #include "CoreSDK/Messages/NotificationBase.h"
+#include "CoreSDK/Messages/PendingRequestTable.h"
 #include "CoreSDK/Messages/RequestBase.h"
 #include "CoreSDK/Messages/ResponseBase.h"
 #include "JSONProxy.h"
+#include "Utilities/Async/FrameAllocator.h"
+#include "Utilities/Async/ThreadPool.h"
+#include "Utilities/IO/IOReactor.h"
 #include "Utilities/JSON/JSONMessages.h"
 
 MCP_NAMESPACE_BEGIN
 
-class MessageManager
+enum class EDispatchMode : uint8_t
+{
+	Inline,		// Handlers run on the thread that received the message, or in arrival order on the pool if that
+				// thread is a reactor loop
+	Concurrent	// Requests and notifications run on a worker pool
+};
+
+struct MessageDispatchOptions
+{
+	static constexpr std::size_t DEFAULT_WORKER_THREADS{ 0 };
+
+	EDispatchMode Mode{ EDispatchMode::Inline };
+	// Size of a pool owned by the manager; zero shares the process-wide pool
+	std::size_t WorkerThreads{ DEFAULT_WORKER_THREADS };
+	// Handle the messages of each session one at a time, in arrival order. Sessions still run in parallel.
+	bool PreserveSessionOrder{ false };
+	// Bytes of FrameArena given to each request or notification for its coroutine frames; zero uses the pool alone
+	std::size_t FrameArenaSize{ 0 };
+};
+
+class MessageManager : public std::enable_shared_from_this<MessageManager>
 {
 public:
-	using MessageHandler = std::function<void(const JSONData&)>;
+	// Request and notification handlers get the message as received and decode it themselves, only once they run
+	using MessageHandler = std::function<void(const InboundMessage&)>;
+	using RawResponseHandler = std::function<void(const JSONData&)>;
+	// Sends an error the manager answers a request with itself, to the connection the request came from
+	using ErrorReplySender = std::function<void(const ErrorResponseBase&, const std::optional<std::string>&)>;
 
 	// Register handlers for specific concrete message types
 	template <ConcreteRequest T, typename Function> bool RegisterRequestHandler(Function&& InHandler)
@@ -28,25 +66,15 @@ public:
 		static_assert(std::is_invocable_v<Function, const T&>,
 			"Handler must be callable with '(const ConcreteRequestType&)'");
 
-		T TempInstance{};
-		const auto MethodName = std::string(TempInstance.GetRequestMethod());
-
-		std::scoped_lock lock(m_RequestMutex);
-
-		if (m_WarnOnDuplicateHandlers && m_RequestHandlers.contains(MethodName))
-		{
-			HandleRuntimeError("Request handler already exists for message: " + MethodName);
-			return false;
-		}
-
-		m_RequestHandlers[MethodName] = [Handler = std::forward<Function>(InHandler)](const JSONData& InMessage)
-		{
-			JSONData JSONRequest = InMessage;
-			T Request = JSONRequest.get<T>();
-			Handler(Request);
-		};
-
-		return true;
+		return AddHandler(m_RequestHandlers,
+			MethodNameOf<T>(),
+			"Request",
+			[Handler = std::forward<Function>(InHandler)](const InboundMessage& InMessage)
+			{
+				const std::optional<std::string_view> Text = GetMessageText(InMessage);
+				const T Request = Text ? DecodeRequest<T>(*Text) : ParseRequest<T>(std::get<JSONData>(InMessage));
+				Handler(Request);
+			});
 	}
 
 	template <ConcreteResponse T, typename Function>
@@ -55,66 +83,102 @@ public:
 		static_assert(std::is_invocable_v<Function, const T&>,
 			"Handler must be callable with '(const ConcreteResponseType&)'");
 
-		const std::string& ID = InRequestID.ToString();
 		std::scoped_lock lock(m_ResponseMutex);
 
+		if (const int64_t* NumericID = std::get_if<int64_t>(&InRequestID.Value))
+		{
+			if (m_PendingRequests.Contains(*NumericID))
+			{
+				if (m_WarnOnDuplicateHandlers)
+				{
+					HandleRuntimeError("Response handler already exists for message: " + InRequestID.ToString());
+					return false;
+				}
+				m_PendingRequests.Remove(*NumericID);
+			}
+			m_PendingRequests.Insert(*NumericID, std::forward<Function>(InHandler));
+			return true;
+		}
+
+		const std::string& ID = std::get<std::string>(InRequestID.Value);
 		if (m_WarnOnDuplicateHandlers && m_ResponseHandlers.contains(ID))
 		{
 			HandleRuntimeError("Response handler already exists for message: " + ID);
 			return false;
 		}
 
-		m_ResponseHandlers[ID] = InHandler;
+		m_ResponseHandlers[ID] = std::forward<Function>(InHandler);
 
 		return true;
 	}
 
+	// Next ID from this manager's sequence. Integer IDs are correlated through the pending table without strings.
+	[[nodiscard]] RequestID AllocateRequestID()
+	{
+		return RequestID{ m_NextRequestID.fetch_add(1, std::memory_order_relaxed) };
+	}
+
 	template <ConcreteNotification T, typename Function> bool RegisterNotificationHandler(Function&& InHandler)
 	{
 		static_assert(std::is_invocable_v<Function, const T&>,
 			"Handler must be callable with '(const ConcreteNotificationType&)'");
 
-		T TempInstance{};
-		const auto MethodName = std::string(TempInstance.GetNotificationMethod());
-
-		std::scoped_lock lock(m_NotificationMutex);
+		return AddHandler(m_NotificationHandlers,
+			MethodNameOf<T>(),
+			"Notification",
+			[Handler = std::forward<Function>(InHandler)](const InboundMessage& InMessage)
+			{
+				const std::optional<std::string_view> Text = GetMessageText(InMessage);
+				const T Notification
+					= Text ? DecodeNotification<T>(*Text) : ParseNotification<T>(std::get<JSONData>(InMessage));
+				Handler(Notification);
+			});
+	}
 
-		if (m_WarnOnDuplicateHandlers && m_NotificationHandlers.contains(MethodName))
+	// Main routing function - receives JSON string and routes to the appropriate
+	// handler
+	bool RouteMessage(InboundMessage InMessage, const std::optional<std::string>& InConnectionID = std::nullopt)
+	{
+		try
 		{
-			HandleRuntimeError("Notification handler already exists for message: " + MethodName);
-			return false;
+			const MessageEnvelope Envelope = GetEnvelope(InMessage);
+			return RouteMessage(std::move(InMessage), Envelope, InConnectionID);
 		}
-
-		m_NotificationHandlers[MethodName] = [Handler = std::forward<Function>(InHandler)](const JSONData& InMessage)
+		catch (const std::exception& e)
 		{
-			JSONData JSONNotification = InMessage;
-			T Notification = JSONNotification.get<T>();
-			Handler(Notification);
-		};
-
-		return true;
+			HandleRuntimeError("Error parsing message: " + std::string(e.what()));
+			return false;
+		}
 	}
 
-	// Main routing function - receives JSON string and routes to the appropriate
-	// handler
-	bool RouteMessage(const std::string& InMessage)
+	/**
+	 * Routes a message by its envelope alone. The rest of the text is only decoded by the handler it reaches, so a
+	 * message nobody handles costs no more than its envelope. Handlers can read InConnectionID through MessageContext.
+	 * In concurrent mode, and on a reactor loop thread, requests and notifications are queued and this returns before
+	 * their handler has run; responses are always handled on the calling thread, as are the elements of a batch, which
+	 * the batch itself already spreads over the pool.
+	 */
+	bool RouteMessage(InboundMessage InMessage,
+		const MessageEnvelope& InEnvelope,
+		const std::optional<std::string>& InConnectionID = std::nullopt)
 	{
 		try
 		{
-			const JSONData Message = JSONData::parse(InMessage);
+			m_HasRouted.store(true, std::memory_order_relaxed);
+			const MessageContext::Scope Context(InConnectionID);
 
-			if (std::optional<EMessageType> MessageType = GetValidMessageType(Message))
+			if (const std::optional<EMessageType> MessageType = InEnvelope.Type)
 			{
 				switch (MessageType.value())
 				{
 					case EMessageType::Request:
-						return RouteRequest(Message);
+						return RouteRequest(std::move(InMessage), InEnvelope, InConnectionID);
 					case EMessageType::Response:
-						return RouteResponse(Message);
+						return RouteResponse(InMessage, InEnvelope);
 					case EMessageType::Notification:
-						return RouteNotification(Message);
+						return RouteNotification(std::move(InMessage), InEnvelope, InConnectionID);
 					case EMessageType::Error:
-						return RouteResponse(Message);
+						return RouteResponse(InMessage, InEnvelope);
 					default:
 						HandleRuntimeError(
 							"Invalid message type: " + std::to_string(static_cast<int>(MessageType.value())));
@@ -127,48 +191,229 @@ public:
 		}
 		catch (const std::exception& e)
 		{
-			HandleRuntimeError("Error parsing message: " + std::string(e.what()));
+			HandleRuntimeError("Error routing message: " + std::string(e.what()));
 			return false;
 		}
 	}
 
 	bool UnregisterRequestHandler(const std::string& InMethod)
 	{
-
-		std::scoped_lock lock(m_RequestMutex);
-		return m_ResponseHandlers.erase(InMethod) > 0;
+		return UpdateHandlers(m_RequestHandlers,
+			[&InMethod](HandlerTable& InHandlers) { return InHandlers.Remove(InMethod); });
 	}
 
 	bool UnregisterNotificationHandler(const std::string& InMethod)
 	{
-		std::scoped_lock lock(m_NotificationMutex);
-		return m_ResponseHandlers.erase(InMethod) > 0;
+		return UpdateHandlers(m_NotificationHandlers,
+			[&InMethod](HandlerTable& InHandlers) { return InHandlers.Remove(InMethod); });
 	}
 
 	bool UnregisterResponseHandler(const RequestID& InRequestID)
 	{
 		std::scoped_lock lock(m_ResponseMutex);
-		return m_ResponseHandlers.erase(InRequestID.ToString()) > 0;
+		if (const int64_t* NumericID = std::get_if<int64_t>(&InRequestID.Value))
+		{
+			return m_PendingRequests.Remove(*NumericID);
+		}
+		return m_ResponseHandlers.erase(std::get<std::string>(InRequestID.Value)) > 0;
+	}
+
+	/**
+	 * Dispatch reads the options without a lock, so they can only be set before the first message is routed.
+	 * @return False, leaving the options as they were, once a message has been routed
+	 */
+	bool SetDispatchOptions(const MessageDispatchOptions& InOptions)
+	{
+		if (m_HasRouted.load(std::memory_order_relaxed))
+		{
+			HandleRuntimeError("Dispatch options cannot change once messages are being routed");
+			return false;
+		}
+
+		m_DispatchOptions = InOptions;
+		m_OwnedPool = InOptions.Mode == EDispatchMode::Concurrent && InOptions.WorkerThreads > 0
+			? std::make_shared<ThreadPool>(InOptions.WorkerThreads)
+			: nullptr;
+		return true;
 	}
 
+	[[nodiscard]] const MessageDispatchOptions& GetDispatchOptions() const { return m_DispatchOptions; }
+
+	// Set up before messages start flowing; without one, a request nobody handles is only reported
+	void SetErrorReplySender(ErrorReplySender InSender) { m_ErrorReplySender = std::move(InSender); }
+
 	explicit MessageManager(const bool InWarnOnDuplicateHandlers) : m_WarnOnDuplicateHandlers(InWarnOnDuplicateHandlers)
 	{}
 
+	// Queued handlers keep the manager alive, so the last reference can go from one of its own pool's workers. That
+	// worker cannot join itself; the shared pool takes the last reference and shuts it down once the job has returned.
+	~MessageManager() noexcept
+	{
+		if (m_OwnedPool && m_OwnedPool->IsWorkerThread())
+		{
+			ThreadPool::Shared().Post([Pool = std::move(m_OwnedPool)] {});
+		}
+	}
+
+	MessageManager(const MessageManager&) = delete;
+	MessageManager(MessageManager&&) = delete;
+	MessageManager& operator=(const MessageManager&) = delete;
+	MessageManager& operator=(MessageManager&&) = delete;
+
 private:
+	// Hashes string views so custom methods are looked up straight from the message, without building a std::string
+	struct MethodHash
+	{
+		using is_transparent = void;
+		std::size_t operator()(const std::string_view InMethod) const noexcept
+		{
+			return std::hash<std::string_view>{}(InMethod);
+		}
+	};
+
+	/**
+	 * Spec methods index a fixed array through the compile-time perfect hash in MethodTable.h; only methods outside
+	 * the spec fall back to the hashed map.
+	 */
+	struct HandlerTable
+	{
+		std::array<MessageHandler, MCP_METHOD_COUNT> Standard;
+		std::unordered_map<std::string, MessageHandler, MethodHash, std::equal_to<>> Custom;
+
+		[[nodiscard]] const MessageHandler* Find(const std::string_view InMethod) const
+		{
+			if (const std::optional<EMCPMethod> Method = FindMCPMethod(InMethod))
+			{
+				const MessageHandler& Handler = Standard[static_cast<std::size_t>(Method.value())];
+				return Handler ? &Handler : nullptr;
+			}
+			const auto Iter = Custom.find(InMethod);
+			return Iter != Custom.end() ? &Iter->second : nullptr;
+		}
+
+		void Set(const std::string_view InMethod, MessageHandler InHandler)
+		{
+			if (const std::optional<EMCPMethod> Method = FindMCPMethod(InMethod))
+			{
+				Standard[static_cast<std::size_t>(Method.value())] = std::move(InHandler);
+				return;
+			}
+			Custom.insert_or_assign(std::string(InMethod), std::move(InHandler));
+		}
+
+		bool Remove(const std::string_view InMethod)
+		{
+			if (const std::optional<EMCPMethod> Method = FindMCPMethod(InMethod))
+			{
+				return std::exchange(Standard[static_cast<std::size_t>(Method.value())], nullptr) != nullptr;
+			}
+			const auto Iter = Custom.find(InMethod);
+			if (Iter == Custom.end())
+			{
+				return false;
+			}
+			Custom.erase(Iter);
+			return true;
+		}
+	};
+
+	/**
+	 * Request and notification tables are replaced wholesale on registration, so routing only locks long enough to
+	 * copy the pointer and looks up its handler without one. A plain mutex rather than an atomic shared_ptr, which
+	 * not every standard library provides.
+	 */
+	using HandlerSnapshot = std::shared_ptr<const HandlerTable>;
+
+	[[nodiscard]] HandlerSnapshot LoadHandlers(const HandlerSnapshot& InTable) const
+	{
+		std::scoped_lock Lock(m_SnapshotMutex);
+		return InTable;
+	}
+
+	// Spec messages name their method statically; other message types are asked through a default constructed instance
+	template <typename T> static std::string MethodNameOf()
+	{
+		if constexpr (requires { T::METHOD; })
+		{
+			return std::string(T::METHOD);
+		}
+		else if constexpr (ConcreteRequest<T>)
+		{
+			const T TempInstance{};
+			return std::string(TempInstance.GetRequestMethod());
+		}
+		else
+		{
+			const T TempInstance{};
+			return std::string(TempInstance.GetNotificationMethod());
+		}
+	}
+
+	bool AddHandler(HandlerSnapshot& InTable,
+		const std::string& InMethod,
+		const std::string_view InKind,
+		MessageHandler InHandler)
+	{
+		return UpdateHandlers(InTable,
+			[&](HandlerTable& InHandlers)
+			{
+				if (m_WarnOnDuplicateHandlers && InHandlers.Find(InMethod) != nullptr)
+				{
+					HandleRuntimeError(std::string(InKind) + " handler already exists for message: " + InMethod);
+					return false;
+				}
+				InHandlers.Set(InMethod, std::move(InHandler));
+				return true;
+			});
+	}
+
+	template <typename Mutator> bool UpdateHandlers(HandlerSnapshot& InTable, Mutator&& InMutator)
+	{
+		// Only registration replaces a table, so under this lock it can be read as is
+		std::scoped_lock Lock(m_RegistrationMutex);
+		auto Updated = std::make_shared<HandlerTable>(*InTable);
+		if (!InMutator(*Updated))
+		{
+			return false;
+		}
+
+		// The previous table is released outside the lock, in case this was its last reference
+		HandlerSnapshot Previous;
+		{
+			std::scoped_lock SnapshotLock(m_SnapshotMutex);
+			Previous = std::exchange(InTable, std::move(Updated));
+		}
+		return true;
+	}
+
 	// Message type routing functions
-	bool RouteRequest(const JSONData& InMessage)
+	bool RouteRequest(InboundMessage&& InMessage,
+		const MessageEnvelope& InEnvelope,
+		const std::optional<std::string>& InConnectionID)
 	{
 		try
 		{
-			const std::string Method = ExtractMethod(InMessage);
-
-			std::scoped_lock Lock(m_RequestMutex);
-			if (const auto Iter = m_RequestHandlers.find(Method); Iter != m_RequestHandlers.end())
+			HandlerSnapshot Handlers = LoadHandlers(m_RequestHandlers);
+			if (const MessageHandler* Handler = Handlers->Find(InEnvelope.Method))
 			{
-				Iter->second(InMessage);
+				Dispatch(std::move(Handlers), Handler, std::move(InMessage), InConnectionID);
 				return true;
 			}
-			HandleRuntimeError("No handler registered for request method: " + Method);
+			// Every request gets an answer, including those nobody handles; in a batch it joins the batch reply
+			if (InEnvelope.ID)
+			{
+				const ErrorResponseBase Error
+					= ErrorMethodNotFound(*InEnvelope.ID, "Method not found: " + InEnvelope.Method);
+				if (BatchCollector* Batch = MessageContext::GetBatch())
+				{
+					Batch->Add(Error);
+				}
+				else if (m_ErrorReplySender)
+				{
+					m_ErrorReplySender(Error, InConnectionID);
+				}
+			}
+			HandleRuntimeError("No handler registered for request method: " + InEnvelope.Method);
 			return false;
 		}
 		catch (const std::exception& e)
@@ -178,27 +423,48 @@ private:
 		}
 	}
 
-	bool RouteResponse(const JSONData& InMessage)
+	bool RouteResponse(const InboundMessage& InMessage, const MessageEnvelope& InEnvelope)
 	{
 		try
 		{
-			const std::optional<RequestID> RequestID = ExtractRequestID(InMessage);
-
-			if (!RequestID)
+			if (!InEnvelope.ID)
 			{
 				HandleRuntimeError("No request ID found in response");
 				return false;
 			}
 
-			std::scoped_lock Lock(m_ResponseMutex);
-			if (const auto Iter = m_ResponseHandlers.find(RequestID.value().ToString());
-				Iter != m_ResponseHandlers.end())
+			// A response completes its request exactly once; the handler is taken out so it runs without the lock
+			RawResponseHandler Handler;
+			{
+				std::scoped_lock Lock(m_ResponseMutex);
+				if (const int64_t* NumericID = std::get_if<int64_t>(&InEnvelope.ID->Value))
+				{
+					if (std::optional<RawResponseHandler> Pending = m_PendingRequests.Take(*NumericID))
+					{
+						Handler = std::move(Pending.value());
+					}
+				}
+				else if (const auto Iter = m_ResponseHandlers.find(std::get<std::string>(InEnvelope.ID->Value));
+					Iter != m_ResponseHandlers.end())
+				{
+					Handler = std::move(Iter->second);
+					m_ResponseHandlers.erase(Iter);
+				}
+			}
+
+			if (!Handler)
+			{
+				HandleRuntimeError("No handler registered for response ID: " + InEnvelope.ID->ToString());
+				return false;
+			}
+			// Only a response somebody is waiting for is parsed
+			if (const std::optional<std::string_view> Text = GetMessageText(InMessage))
 			{
-				Iter->second(InMessage);
+				Handler(JSONData::parse(*Text));
 				return true;
 			}
-			HandleRuntimeError("No handler registered for response ID: " + RequestID.value().ToString());
-			return false;
+			Handler(std::get<JSONData>(InMessage));
+			return true;
 		}
 		catch (const std::exception& e)
 		{
@@ -207,19 +473,19 @@ private:
 		}
 	}
 
-	bool RouteNotification(const JSONData& InMessage)
+	bool RouteNotification(InboundMessage&& InMessage,
+		const MessageEnvelope& InEnvelope,
+		const std::optional<std::string>& InConnectionID)
 	{
 		try
 		{
-			const std::string Method = ExtractMethod(InMessage);
-
-			std::scoped_lock lock(m_NotificationMutex);
-			if (const auto Iter = m_NotificationHandlers.find(Method); Iter != m_NotificationHandlers.end())
+			HandlerSnapshot Handlers = LoadHandlers(m_NotificationHandlers);
+			if (const MessageHandler* Handler = Handlers->Find(InEnvelope.Method))
 			{
-				Iter->second(InMessage);
+				Dispatch(std::move(Handlers), Handler, std::move(InMessage), InConnectionID);
 				return true;
 			}
-			HandleRuntimeError("No handler registered for notification method: " + Method);
+			HandleRuntimeError("No handler registered for notification method: " + InEnvelope.Method);
 			return false;
 		}
 		catch (const std::exception& e)
@@ -229,16 +495,116 @@ private:
 		}
 	}
 
-	std::unordered_map<std::string, MessageHandler> m_RequestHandlers;
-	std::unordered_map<std::string, MessageHandler> m_ResponseHandlers;
-	std::unordered_map<std::string, MessageHandler> m_NotificationHandlers;
+	/**
+	 * Run a handler inline or queue it on the pool. The snapshot keeps the handler alive until it has run; the message
+	 * is moved along rather than copied, and borrowed text is only copied once it has to outlive the call.
+	 * A reactor loop thread serves many handles, so handlers it would run inline are queued per session instead,
+	 * which keeps them in arrival order without holding up the loop.
+	 */
+	void Dispatch(HandlerSnapshot InHandlers,
+		const MessageHandler* InHandler,
+		InboundMessage&& InMessage,
+		const std::optional<std::string>& InConnectionID)
+	{
+		const bool IsInline = m_DispatchOptions.Mode == EDispatchMode::Inline;
+		if ((IsInline && !IOReactor::IsLoopThread()) || MessageContext::GetBatch() != nullptr)
+		{
+			const FrameArena::Scope Arena(m_DispatchOptions.FrameArenaSize);
+			(*InHandler)(InMessage);
+			return;
+		}
+
+		if (const std::string_view* Borrowed = std::get_if<std::string_view>(&InMessage))
+		{
+			InMessage = std::string(*Borrowed);
+		}
+
+		// The job holds the manager, so dropping the last outside reference never leaves it pointing at freed memory
+		ThreadPool::Job Job = [Self = shared_from_this(), Handlers = std::move(InHandlers), InHandler,
+								  Message = std::move(InMessage), InConnectionID,
+								  ArenaSize = m_DispatchOptions.FrameArenaSize]
+		{
+			try
+			{
+				const MessageContext::Scope Context(InConnectionID);
+				const FrameArena::Scope Arena(ArenaSize);
+				(*InHandler)(Message);
+			}
+			catch (const std::exception& e)
+			{
+				HandleRuntimeError("Error handling message: " + std::string(e.what()));
+			}
+		};
+
+		if (IsInline || m_DispatchOptions.PreserveSessionOrder)
+		{
+			EnqueueForSession(InConnectionID.value_or(std::string{}), std::move(Job));
+			return;
+		}
+		GetPool().Post(std::move(Job));
+	}
+
+	// Only one drain per session is scheduled at a time, which keeps the session's messages in arrival order
+	void EnqueueForSession(const std::string& InSessionID, ThreadPool::Job InJob)
+	{
+		{
+			std::scoped_lock Lock(m_SessionQueuesMutex);
+			auto [Iter, IsNew] = m_SessionQueues.try_emplace(InSessionID);
+			Iter->second.emplace_back(std::move(InJob));
+			if (!IsNew)
+			{
+				return;
+			}
+		}
+		GetPool().Post([Self = shared_from_this(), InSessionID] { Self->DrainSession(InSessionID); });
+	}
+
+	void DrainSession(const std::string& InSessionID)
+	{
+		while (true)
+		{
+			ThreadPool::Job Job;
+			{
+				std::scoped_lock Lock(m_SessionQueuesMutex);
+				const auto Iter = m_SessionQueues.find(InSessionID);
+				if (Iter->second.empty())
+				{
+					m_SessionQueues.erase(Iter);
+					return;
+				}
+				Job = std::move(Iter->second.front());
+				Iter->second.pop_front();
+			}
+			Job();
+		}
+	}
+
+	[[nodiscard]] ThreadPool& GetPool() const { return m_OwnedPool ? *m_OwnedPool : ThreadPool::Shared(); }
+
+	HandlerSnapshot m_RequestHandlers{ std::make_shared<const HandlerTable>() };
+	HandlerSnapshot m_NotificationHandlers{ std::make_shared<const HandlerTable>() };
+	// Responses to integer IDs, including every ID from AllocateRequestID; string IDs chosen elsewhere use the map
+	PendingRequestTable<RawResponseHandler> m_PendingRequests;
+	std::unordered_map<std::string, RawResponseHandler> m_ResponseHandlers;
+	std::atomic<int64_t> m_NextRequestID{ 1 };
 
 	// Mutexes for thread safety
-	std::mutex m_RequestMutex;
+	std::mutex m_RegistrationMutex;
 	std::mutex m_ResponseMutex;
-	std::mutex m_NotificationMutex;
+	// Guards the handler table pointers themselves, never a lookup
+	mutable std::mutex m_SnapshotMutex;
 
 	bool m_WarnOnDuplicateHandlers{ true };
+
+	ErrorReplySender m_ErrorReplySender;
+
+	MessageDispatchOptions m_DispatchOptions;
+	std::shared_ptr<ThreadPool> m_OwnedPool;
+	// Set by the first routed message, after which the dispatch options are fixed
+	std::atomic<bool> m_HasRouted{ false };
+
+	std::mutex m_SessionQueuesMutex;
+	std::unordered_map<std::string, std::deque<ThreadPool::Job>> m_SessionQueues;
 };
 
-MCP_NAMESPACE_END
\ No newline at end of file
+MCP_NAMESPACE_END
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "CoreSDK/Common/Macros.h"
+
+MCP_NAMESPACE_BEGIN
+
+// Every request and notification method defined by the MCP specification
+enum class EMCPMethod : uint8_t
+{
+	Initialize,
+	Ping,
+	ListTools,
+	CallTool,
+	ListPrompts,
+	GetPrompt,
+	ListResources,
+	ListResourceTemplates,
+	ReadResource,
+	Subscribe,
+	Unsubscribe,
+	CreateMessage,
+	ListRoots,
+	SetLevel,
+	Complete,
+	Initialized,
+	ToolListChanged,
+	PromptListChanged,
+	ResourceUpdated,
+	ResourceListChanged,
+	RootsListChanged,
+	LoggingMessage,
+	Progress,
+	Cancelled,
+
+	Count
+};
+
+inline constexpr std::size_t MCP_METHOD_COUNT{ static_cast<std::size_t>(EMCPMethod::Count) };
+
+// Wire names, indexed by EMCPMethod
+inline constexpr std::array<std::string_view, MCP_METHOD_COUNT> MCP_METHOD_NAMES{
+	"initialize",
+	"ping",
+	"tools/list",
+	"tools/call",
+	"prompts/list",
+	"prompts/get",
+	"resources/list",
+	"resources/templates/list",
+	"resources/read",
+	"resources/subscribe",
+	"resources/unsubscribe",
+	"sampling/createMessage",
+	"roots/list",
+	"logging/setLevel",
+	"completion/complete",
+	"notifications/initialized",
+	"notifications/tools/list_changed",
+	"notifications/prompts/list_changed",
+	"notifications/resources/updated",
+	"notifications/resources/list_changed",
+	"notifications/roots/list_changed",
+	"notifications/message",
+	"notifications/progress",
+	"notifications/cancelled",
+};
+
+namespace MethodTableDetail
+{
+	inline constexpr std::size_t SLOT_COUNT{ 64 };
+	inline constexpr uint8_t EMPTY_SLOT{ 0xFF };
+
+	// FNV-1a folded with a seed; the seed is chosen at compile time so that no two spec methods share a slot
+	constexpr uint32_t Hash(const std::string_view InName, const uint32_t InSeed)
+	{
+		uint32_t Value = 2166136261u ^ InSeed;
+		for (const char Character : InName)
+		{
+			Value = (Value ^ static_cast<uint8_t>(Character)) * 16777619u;
+		}
+		return Value ^ (Value >> 15);
+	}
+
+	struct PerfectHash
+	{
+		uint32_t Seed{ 0 };
+		std::array<uint8_t, SLOT_COUNT> Slots{};
+	};
+
+	consteval PerfectHash BuildPerfectHash()
+	{
+		for (uint32_t Seed = 0; Seed < 1u << 16; ++Seed)
+		{
+			PerfectHash Candidate{ Seed, {} };
+			Candidate.Slots.fill(EMPTY_SLOT);
+
+			bool HasCollision = false;
+			for (std::size_t Index = 0; Index < MCP_METHOD_COUNT && !HasCollision; ++Index)
+			{
+				uint8_t& Slot = Candidate.Slots[Hash(MCP_METHOD_NAMES[Index], Seed) % SLOT_COUNT];
+				HasCollision = Slot != EMPTY_SLOT;
+				Slot = static_cast<uint8_t>(Index);
+			}
+			if (!HasCollision)
+			{
+				return Candidate;
+			}
+		}
+		throw "No collision-free seed for the MCP method table";
+	}
+
+	inline constexpr PerfectHash TABLE{ BuildPerfectHash() };
+} // namespace MethodTableDetail
+
+/**
+ * Maps a wire method name to its spec method with one hash and one string compare.
+ * Returns nullopt for anything outside the spec, which callers handle through their own dynamic lookup.
+ */
+[[nodiscard]] constexpr std::optional<EMCPMethod> FindMCPMethod(const std::string_view InName)
+{
+	using namespace MethodTableDetail;
+
+	const uint8_t Slot = TABLE.Slots[Hash(InName, TABLE.Seed) % SLOT_COUNT];
+	if (Slot == EMPTY_SLOT || MCP_METHOD_NAMES[Slot] != InName)
+	{
+		return std::nullopt;
+	}
+	return static_cast<EMCPMethod>(Slot);
+}
+
+[[nodiscard]] constexpr std::string_view ToString(const EMCPMethod InMethod)
+{
+	return MCP_METHOD_NAMES[static_cast<std::size_t>(InMethod)];
+}
+
+static_assert(FindMCPMethod("tools/call") == EMCPMethod::CallTool);
+static_assert(FindMCPMethod("notifications/cancelled") == EMCPMethod::Cancelled);
+static_assert(!FindMCPMethod("tools/unknown").has_value());
+
+MCP_NAMESPACE_END
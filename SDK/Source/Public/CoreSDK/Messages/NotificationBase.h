@@ -1,11 +1,14 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "CoreSDK/Messages/MessageBase.h"
 #include "JSONProxy.h"
+#include "Utilities/JSON/JSONReader.h"
 
 struct NotificationBase;
 
@@ -33,11 +36,11 @@ struct NotificationParams
 		virtual ~NotificationParamsMeta() = default;
 	};
 
-	const std::optional<NotificationParamsMeta>& Meta{ std::nullopt };
+	std::optional<NotificationParamsMeta> Meta{ std::nullopt };
 
 	JSON_KEY(METAKEY, Meta, "_meta")
 
-	DEFINE_TYPE_JSON(NotificationParams, METAKEY)
+	DEFINE_TYPE_JSON_POLYMORPHIC(NotificationParams, METAKEY)
 
 	virtual ~NotificationParams() = default;
 	explicit NotificationParams(const std::optional<NotificationParamsMeta>& InMeta = std::nullopt) : Meta(InMeta) {}
@@ -96,6 +99,81 @@ template <typename T>
 concept ConcreteNotification = std::is_base_of_v<NotificationBase, T>;
 
 // Get typed params - cast the base Params to the derived notification's Params type
+// The params type a concrete notification carries: its own nested Params or the base params
+template <ConcreteNotification T> struct NotificationParamsOf
+{
+	using Type = NotificationParams;
+};
+
+template <ConcreteNotification T>
+	requires requires { typename T::Params; }
+struct NotificationParamsOf<T>
+{
+	using Type = typename T::Params;
+};
+
+// Build a concrete notification straight from a parsed message, with its params built once as its own params type
+template <ConcreteNotification T> [[nodiscard]] T ParseNotification(const JSONData& InJSON)
+{
+	using ParamsType = typename NotificationParamsOf<T>::Type;
+
+	T Notification;
+	InJSON.at("jsonrpc").get_to(Notification.JSONRPC);
+	InJSON.at("method").get_to(Notification.Method);
+	if (const auto Params = InJSON.find("params"); Params != InJSON.end() && !Params->is_null())
+	{
+		auto TypedParams = std::make_unique<ParamsType>();
+		Params->get_to(*TypedParams);
+		Notification.ParamsData = std::move(TypedParams);
+	}
+	return Notification;
+}
+
+// ParseNotification straight from the message text, without building a document for it
+template <ConcreteNotification T> [[nodiscard]] T DecodeNotification(const std::string_view InText)
+{
+	using ParamsType = typename NotificationParamsOf<T>::Type;
+
+	T Notification;
+	bool HasJSONRPC{ false };
+	bool HasMethod{ false };
+
+	JSONReader Reader(InText);
+	Reader.BeginObject();
+	while (const std::optional<std::string_view> Key = Reader.NextKey())
+	{
+		if (Key.value() == "jsonrpc")
+		{
+			ReadJSON(Reader, Notification.JSONRPC);
+			HasJSONRPC = true;
+		}
+		else if (Key.value() == "method")
+		{
+			ReadJSON(Reader, Notification.Method);
+			HasMethod = true;
+		}
+		else if (Key.value() == "params" && Reader.Peek() != JSONReader::EValueType::Null)
+		{
+			auto TypedParams = std::make_unique<ParamsType>();
+			ReadJSON(Reader, *TypedParams);
+			Notification.ParamsData = std::move(TypedParams);
+		}
+		else
+		{
+			Reader.Skip();
+		}
+	}
+	Reader.ExpectEnd();
+
+	if (!HasJSONRPC || !HasMethod)
+	{
+		throw JSONData::out_of_range::create(403,
+			std::string("key '") + (!HasJSONRPC ? "jsonrpc" : "method") + "' not found",
+			nullptr);
+	}
+	return Notification;
+}
+
 template <typename TParamsType, ConcreteNotification T>
 [[nodiscard]] std::optional<const TParamsType*> GetNotificationParams(T& InNotification)
 {
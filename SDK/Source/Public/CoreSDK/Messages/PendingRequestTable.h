@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Open-addressed table of the requests awaiting a response, keyed by integer request ID.
+ * IDs handed out by MessageManager are consecutive, so with the identity hash live entries land in consecutive slots
+ * and lookups resolve on the first probe. Removal shifts the following entries back so no tombstones build up.
+ * Not thread-safe; the owner serializes access.
+ */
+template <typename ValueType> class PendingRequestTable
+{
+public:
+	static constexpr std::size_t DEFAULT_CAPACITY{ 64 };
+
+	explicit PendingRequestTable(const std::size_t InCapacity = DEFAULT_CAPACITY)
+		: m_Slots(std::bit_ceil(std::max<std::size_t>(InCapacity, 2)))
+	{}
+
+	// Returns false if the ID is already pending
+	bool Insert(const int64_t InID, ValueType InValue)
+	{
+		if ((m_Size + 1) * 2 > m_Slots.size())
+		{
+			Grow();
+		}
+
+		std::size_t Index = IndexOf(InID);
+		for (; m_Slots[Index].IsOccupied; Index = Next(Index))
+		{
+			if (m_Slots[Index].ID == InID)
+			{
+				return false;
+			}
+		}
+
+		m_Slots[Index] = Slot{ InID, std::move(InValue), true };
+		++m_Size;
+		return true;
+	}
+
+	[[nodiscard]] bool Contains(const int64_t InID) const { return Find(InID).has_value(); }
+
+	// Removes the entry and hands back its value
+	[[nodiscard]] std::optional<ValueType> Take(const int64_t InID)
+	{
+		const std::optional<std::size_t> Found = Find(InID);
+		if (!Found)
+		{
+			return std::nullopt;
+		}
+
+		std::optional<ValueType> Value{ std::move(m_Slots[Found.value()].Value) };
+		Erase(Found.value());
+		return Value;
+	}
+
+	bool Remove(const int64_t InID)
+	{
+		const std::optional<std::size_t> Found = Find(InID);
+		if (!Found)
+		{
+			return false;
+		}
+		Erase(Found.value());
+		return true;
+	}
+
+	[[nodiscard]] std::size_t Size() const { return m_Size; }
+	[[nodiscard]] bool IsEmpty() const { return m_Size == 0; }
+
+private:
+	struct Slot
+	{
+		int64_t ID{ 0 };
+		ValueType Value{};
+		bool IsOccupied{ false };
+	};
+
+	[[nodiscard]] std::optional<std::size_t> Find(const int64_t InID) const
+	{
+		for (std::size_t Index = IndexOf(InID); m_Slots[Index].IsOccupied; Index = Next(Index))
+		{
+			if (m_Slots[Index].ID == InID)
+			{
+				return Index;
+			}
+		}
+		return std::nullopt;
+	}
+
+	// Backward-shift deletion: pull later entries of the probe run into the hole so every entry stays reachable
+	void Erase(std::size_t InHole)
+	{
+		for (std::size_t Index = Next(InHole); m_Slots[Index].IsOccupied; Index = Next(Index))
+		{
+			const std::size_t Home = IndexOf(m_Slots[Index].ID);
+			// Move the entry only if its home slot is not cyclically between the hole and its current slot
+			if (((Index - Home) & Mask()) >= ((Index - InHole) & Mask()))
+			{
+				m_Slots[InHole] = std::move(m_Slots[Index]);
+				InHole = Index;
+			}
+		}
+		m_Slots[InHole] = Slot{};
+		--m_Size;
+	}
+
+	void Grow()
+	{
+		std::vector<Slot> Previous = std::exchange(m_Slots, std::vector<Slot>(m_Slots.size() * 2));
+		m_Size = 0;
+		for (Slot& Entry : Previous)
+		{
+			if (Entry.IsOccupied)
+			{
+				Insert(Entry.ID, std::move(Entry.Value));
+			}
+		}
+	}
+
+	[[nodiscard]] std::size_t Mask() const { return m_Slots.size() - 1; }
+	[[nodiscard]] std::size_t IndexOf(const int64_t InID) const { return static_cast<std::size_t>(InID) & Mask(); }
+	[[nodiscard]] std::size_t Next(const std::size_t InIndex) const { return (InIndex + 1) & Mask(); }
+
+	std::vector<Slot> m_Slots;
+	std::size_t m_Size{ 0 };
+};
+
+MCP_NAMESPACE_END
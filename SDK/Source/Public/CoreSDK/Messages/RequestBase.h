@@ -2,14 +2,17 @@
 
 #include <functional>
 #include <optional>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <variant>
 
 #include "CoreSDK/Common/Progress.h"
 #include "CoreSDK/Messages/MessageBase.h"
 #include "JSONProxy.h"
-#include "UUIDProxy.h"
+#include "Utilities/JSON/JSONReader.h"
 
 struct RequestBase;
 class MCPContext;
@@ -28,6 +31,7 @@ struct RequestID
 {
 	std::variant<std::string, int64_t> Value;
 
+	// Unassigned; MCPProtocol numbers such requests when it sends them
 	RequestID() : Value("") {}
 	explicit RequestID(const std::string& InValue) : Value(InValue) {}
 	explicit RequestID(int64_t InValue) : Value(InValue) {}
@@ -50,7 +54,17 @@ struct RequestID
 			Value);
 	}
 
-	friend void to_json(JSONData& InJSON, const RequestID& InRequestID) { InJSON = InRequestID.ToString(); }
+	[[nodiscard]] bool IsAssigned() const
+	{
+		const std::string* StringValue = std::get_if<std::string>(&Value);
+		return StringValue == nullptr || !StringValue->empty();
+	}
+
+	// Integer IDs stay integers on the wire so peers can correlate them with what they sent
+	friend void to_json(JSONData& InJSON, const RequestID& InRequestID)
+	{
+		std::visit([&InJSON](const auto& InValue) { InJSON = InValue; }, InRequestID.Value);
+	}
 
 	friend void from_json(const JSONData& InJSON, RequestID& InRequestID)
 	{
@@ -93,7 +107,7 @@ struct RequestParams
 
 	JSON_KEY(METAKEY, Meta, "_meta")
 
-	DEFINE_TYPE_JSON(RequestParams, METAKEY)
+	DEFINE_TYPE_JSON_POLYMORPHIC(RequestParams, METAKEY)
 
 	explicit RequestParams(const std::optional<RequestParamsMeta>& InMeta = std::nullopt) : Meta(InMeta) {}
 	virtual ~RequestParams() = default;
@@ -127,7 +141,6 @@ struct PaginatedRequestParams : RequestParams
 
 	DEFINE_TYPE_JSON_DERIVED(PaginatedRequestParams, RequestParams, CURSORKEY)
 
-	PaginatedRequestParams() = default;
 	~PaginatedRequestParams() override = default;
 
 	explicit PaginatedRequestParams(const std::optional<std::string>& InCursor = std::nullopt,
@@ -183,7 +196,6 @@ struct RequestBase : MessageBase
 	explicit RequestBase(const std::string_view InMethod,
 		std::optional<std::unique_ptr<RequestParams>> InParams = std::nullopt)
 		: MessageBase(),
-		  ID(GenerateUUID()),
 		  Method(InMethod),
 		  ParamsData(std::move(InParams))
 	{}
@@ -209,6 +221,95 @@ struct RequestBase : MessageBase
 template <typename T>
 concept ConcreteRequest = std::is_base_of_v<RequestBase, T>;
 
+// The params type a concrete request carries: its own nested Params, the paginated params, or the base params
+template <ConcreteRequest T> struct RequestParamsOf
+{
+	using Type = std::
+		conditional_t<std::is_constructible_v<T, const PaginatedRequestParams&>, PaginatedRequestParams, RequestParams>;
+};
+
+template <ConcreteRequest T>
+	requires requires { typename T::Params; }
+struct RequestParamsOf<T>
+{
+	using Type = typename T::Params;
+};
+
+/**
+ * Build a concrete request straight from a parsed message. Going through get<T>() would deserialize the params as
+ * RequestParams; here they are built once, as the request's own params type, so GetRequestParams() can use them.
+ */
+template <ConcreteRequest T> [[nodiscard]] T ParseRequest(const JSONData& InJSON)
+{
+	using ParamsType = typename RequestParamsOf<T>::Type;
+
+	T Request;
+	InJSON.at("jsonrpc").get_to(Request.JSONRPC);
+	InJSON.at("id").get_to(Request.ID);
+	InJSON.at("method").get_to(Request.Method);
+	if (const auto Params = InJSON.find("params"); Params != InJSON.end() && !Params->is_null())
+	{
+		auto TypedParams = std::make_unique<ParamsType>();
+		Params->get_to(*TypedParams);
+		Request.ParamsData = std::move(TypedParams);
+	}
+	return Request;
+}
+
+/**
+ * ParseRequest straight from the message text. The request and its params are filled as the text is read, so no
+ * document is built except for free-form JSONData fields inside the params.
+ */
+template <ConcreteRequest T> [[nodiscard]] T DecodeRequest(const std::string_view InText)
+{
+	using ParamsType = typename RequestParamsOf<T>::Type;
+
+	T Request;
+	bool HasJSONRPC{ false };
+	bool HasID{ false };
+	bool HasMethod{ false };
+
+	JSONReader Reader(InText);
+	Reader.BeginObject();
+	while (const std::optional<std::string_view> Key = Reader.NextKey())
+	{
+		if (Key.value() == "jsonrpc")
+		{
+			ReadJSON(Reader, Request.JSONRPC);
+			HasJSONRPC = true;
+		}
+		else if (Key.value() == "id")
+		{
+			ReadJSON(Reader, Request.ID);
+			HasID = true;
+		}
+		else if (Key.value() == "method")
+		{
+			ReadJSON(Reader, Request.Method);
+			HasMethod = true;
+		}
+		else if (Key.value() == "params" && Reader.Peek() != JSONReader::EValueType::Null)
+		{
+			auto TypedParams = std::make_unique<ParamsType>();
+			ReadJSON(Reader, *TypedParams);
+			Request.ParamsData = std::move(TypedParams);
+		}
+		else
+		{
+			Reader.Skip();
+		}
+	}
+	Reader.ExpectEnd();
+
+	if (!HasJSONRPC || !HasID || !HasMethod)
+	{
+		throw JSONData::out_of_range::create(403,
+			std::string("key '") + (!HasJSONRPC ? "jsonrpc" : !HasID ? "id" : "method") + "' not found",
+			nullptr);
+	}
+	return Request;
+}
+
 // Get typed params - cast the base Params to the derived request's Params type
 template <typename TParamsType, ConcreteRequest T>
 [[nodiscard]] std::optional<const TParamsType*> GetRequestParams(const T& InRequest)
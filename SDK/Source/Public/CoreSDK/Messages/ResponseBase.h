@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -33,12 +34,26 @@ struct ResultParams
 
 	JSON_KEY(METAKEY, Meta, "_meta")
 
-	DEFINE_TYPE_JSON(ResultParams, METAKEY)
+	DEFINE_TYPE_JSON_POLYMORPHIC(ResultParams, METAKEY)
 
 	explicit ResultParams(const std::optional<JSONData>& InMeta = std::nullopt) : Meta(InMeta) {}
 	virtual ~ResultParams() = default;
 };
 
+/**
+ * A result serialized ahead of time, such as a cached list. Its text is written into the response as it is, so
+ * sending it again only costs the envelope around it.
+ */
+struct SerializedResultParams final : ResultParams
+{
+	std::shared_ptr<const std::string> Text;
+
+	explicit SerializedResultParams(std::shared_ptr<const std::string> InText) : Text(std::move(InText)) {}
+
+	void SerializeTo(JSONData& OutJSON) const override { OutJSON = JSONData::parse(*Text); }
+	void SerializeTo(JSONWriter& OutWriter) const override { OutWriter.WriteRaw(*Text); }
+};
+
 // PaginatedResult {
 //   MSG_PROPERTIES: {
 //     MSG_META: {
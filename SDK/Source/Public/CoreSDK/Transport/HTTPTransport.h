@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Poco/Net/HTTPClientSession.h>
+#include <Poco/Net/HTTPRequest.h>
 #include <Poco/Net/HTTPRequestHandler.h>
 #include <Poco/Net/HTTPRequestHandlerFactory.h>
 #include <Poco/Net/HTTPResponse.h>
@@ -9,18 +10,68 @@
 #include <Poco/Runnable.h>
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "CoreSDK/Common/Macros.h"
 #include "CoreSDK/Transport/ITransport.h"
+#include "CoreSDK/Transport/SSEEngine.h"
 
 // Forward declarations
 class MCPHTTPRequestHandlerFactory;
 
 MCP_NAMESPACE_BEGIN
 
+/**
+ * Bounded pool of keep-alive client sessions to one server.
+ * Poco sessions carry one request at a time, so concurrency comes from holding several connections open rather than
+ * pipelining on one. Idle sessions are reused most-recently-used first and retired once they sit idle past the idle
+ * timeout or have served the configured number of requests.
+ */
+class HTTPClientSessionPool
+{
+public:
+	struct PooledSession
+	{
+		std::unique_ptr<Poco::Net::HTTPClientSession> Session;
+		std::size_t RequestCount{ 0 };
+		std::chrono::steady_clock::time_point LastUsed;
+		uint64_t Generation{ 0 };
+	};
+
+	explicit HTTPClientSessionPool(const HTTPTransportOptions& InOptions);
+
+	// Take an idle session or open a new one, waiting while MaxConnections are in use
+	[[nodiscard]] PooledSession Acquire();
+
+	/**
+	 * Hand a session back after a request.
+	 * @param InSession The session returned by Acquire()
+	 * @param InIsReusable False if the response was not fully read or the server asked to close the connection
+	 */
+	void Release(PooledSession InSession, bool InIsReusable);
+
+	// Close every idle session. Sessions currently in use are closed as they are released.
+	void Clear();
+
+private:
+	const HTTPTransportOptions& m_Options;
+
+	std::mutex m_Mutex;
+	std::condition_variable m_Available;
+	std::vector<PooledSession> m_Idle;
+	std::size_t m_OpenCount{ 0 };
+	uint64_t m_Generation{ 0 };
+};
+
 // HTTP Client Transport
 class HTTPTransportClient final : public ITransport,
 								  public Poco::Runnable
@@ -39,8 +90,14 @@ public:
 
 	void TransmitMessage(const JSONData& InMessage,
 		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
+	void TransmitMessage(const MessageBase& InMessage,
+		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
 
 	[[nodiscard]] std::string GetConnectionInfo() const override;
+	[[nodiscard]] std::optional<std::chrono::milliseconds> GetRequestTimeout() const override
+	{
+		return m_Options.RequestTimeout;
+	}
 
 protected:
 	// Poco::Runnable interface for SSE reading
@@ -48,19 +105,31 @@ protected:
 
 private:
 	VoidTask ConnectToServer();
+	// POST a serialized message and route whatever the server answers on it
+	void PostBody(std::string_view InBody);
 	void StartSSEConnection();
 	void ProcessSSELine(const std::string& InLine);
+	// Attach the session ID assigned by the server, once there is one
+	void ApplySessionHeader(Poco::Net::HTTPRequest& InRequest) const;
+	// Store the session ID the server assigned and open the session's event stream the first time one arrives
+	void CaptureSessionHeader(const Poco::Net::HTTPResponse& InResponse);
+	// Ask the server to drop our session
+	void TerminateSession();
 	void Cleanup();
 
 	HTTPTransportOptions m_Options;
-	std::unique_ptr<Poco::Net::HTTPClientSession> m_HTTPSession;
-	std::unique_ptr<std::istream> m_SSEStream;
+	HTTPClientSessionPool m_SessionPool;
 
+	// Carries what the server sends outside a POST, such as resources/updated. Aborted to end the stream's read.
+	std::mutex m_SSEMutex;
+	std::unique_ptr<Poco::Net::HTTPClientSession> m_SSESession;
+	// Started once the server has issued a session ID; guarded by m_SessionIDMutex
 	std::jthread m_SSEThread;
 	std::atomic<bool> m_ShouldStop{ false };
 	std::string m_SSEBuffer;
 
-	mutable std::mutex m_ConnectionMutex;
+	mutable std::mutex m_SessionIDMutex;
+	std::string m_SessionID;
 };
 
 // HTTP Server Transport
@@ -76,36 +145,85 @@ public:
 
 	void TransmitMessage(const JSONData& InMessage,
 		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
+	void TransmitMessage(const MessageBase& InMessage,
+		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
 
 	[[nodiscard]] std::string GetConnectionInfo() const override;
+	[[nodiscard]] std::optional<std::chrono::milliseconds> GetRequestTimeout() const override
+	{
+		return m_Options.RequestTimeout;
+	}
 
 	// Server-specific methods
 	void HandleHTTPRequest(Poco::Net::HTTPServerRequest& InRequest, Poco::Net::HTTPServerResponse& InResponse);
-	VoidTask HandleGetMessageEndpoint(const Poco::Net::HTTPServerRequest& InRequest,
+	VoidTask HandleGetMessageEndpoint(Poco::Net::HTTPServerRequest& InRequest,
 		Poco::Net::HTTPServerResponse& InResponse);
-	void RegisterSSEClient(const std::string& InClientID, Poco::Net::HTTPServerResponse& InResponse);
+	bool RegisterSSEClient(const std::string& InClientID, Poco::Net::StreamSocket InSocket);
 	void UnregisterSSEClient(const std::string& InClientID);
-	VoidTask StreamMessagesToClient(const std::string& InClientID);
+	[[nodiscard]] SSEEngineStats GetSSEStats() const { return m_SSEEngine.GetStats(); }
 
 private:
-	void ProcessReceivedMessage(const std::string& InMessage);
+	// A POST held open until the server answers the request, or batch of requests, it carried
+	struct PostExchange
+	{
+		std::vector<std::string> Keys;		   // Session and request ID of every request carried
+		std::vector<std::string> ProgressKeys; // Session and progress token of every request that asked for progress
+
+		std::mutex Mutex;
+		std::condition_variable Ready;
+		std::deque<std::string> Events; // Related notifications not yet written
+		std::optional<std::string> Response;
+	};
+
+	void ProcessReceivedMessage(std::string InMessage, const std::optional<ConnectionID>& InSessionID) const;
+
+	/**
+	 * Register a POSTed request or batch so its response is returned on the POST.
+	 * @param InCanStream Whether the client accepts an event stream, without which progress cannot go on the POST
+	 * @param OutDuplicateID Set if one of the message's IDs is already in flight
+	 * @return Null if the message carries no request or one of its IDs is already in flight
+	 */
+	std::shared_ptr<PostExchange> OpenExchange(const ConnectionID& InSessionID,
+		std::string_view InMessage,
+		bool InCanStream,
+		std::optional<RequestID>& OutDuplicateID);
+	void CloseExchange(const PostExchange& InExchange);
+	/**
+	 * Wait for the response to an exchange and write it to the POST, as application/json or, once a progress
+	 * notification has to go out first, as an event stream. Progress only reaches the POST of a client that listed
+	 * text/event-stream in its Accept header; anyone else is answered with JSON and gets progress on their stream.
+	 */
+	void ReplyToPost(PostExchange& InExchange, Poco::Net::HTTPServerResponse& InResponse);
+	// Hand a message to the POST it belongs to. False if no open POST is waiting for it.
+	bool DeliverToPost(const ConnectionID& InSessionID, const JSONData& InMessage);
+	// The open POST waiting for a response with InResponseID, or for progress on InProgressToken
+	std::shared_ptr<PostExchange> FindExchange(const ConnectionID& InSessionID,
+		const JSONData* InResponseID,
+		const JSONData* InProgressToken);
+	static void DeliverToExchange(PostExchange& InExchange, bool InIsResponse, std::string InBody);
+	// Forget a session and close its stream
+	void CloseSession(const ConnectionID& InSessionID);
+	static void SendSessionNotFound(Poco::Net::HTTPServerResponse& InResponse);
+
+	/**
+	 * Send the event stream headers and greeting, then hand the connection's socket to the SSE engine so the request
+	 * thread returns to the server's pool.
+	 * @return The new stream's client ID, or empty if the stream could not be opened
+	 */
+	std::string OpenEventStream(Poco::Net::HTTPServerRequest& InRequest,
+		Poco::Net::HTTPServerResponse& InResponse,
+		bool InIncludeClientID);
 
 	HTTPTransportOptions m_Options;
 	std::unique_ptr<Poco::Net::HTTPServer> m_HTTPServer;
 	std::unique_ptr<Poco::Net::ServerSocket> m_ServerSocket;
 
 	// SSE client management
-	struct SSEClient
-	{
-		std::string ClientID;
-		Poco::Net::HTTPServerResponse* Response{};
-		std::ostream* Stream{};
-		std::chrono::steady_clock::time_point ConnectedTime;
-		bool IsActive{ false };
-	};
+	SSEEngine m_SSEEngine;
 
-	std::unordered_map<std::string, std::unique_ptr<SSEClient>> m_SSEClients;
-	mutable std::mutex m_ClientsMutex;
+	std::mutex m_ExchangesMutex;
+	std::unordered_map<std::string, std::shared_ptr<PostExchange>> m_Exchanges;
+	std::unordered_map<std::string, std::shared_ptr<PostExchange>> m_ProgressExchanges;
 };
 
 // HTTP Server Transport Request Handler
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -12,9 +15,13 @@
 #include "CoreSDK/Common/ProtocolInfo.h"
 #include "JSONProxy.h"
 #include "Utilities/Async/Task.h"
+#include "Utilities/JSON/JSONMessages.h"
+#include "Utilities/JSON/WireFormat.h"
 
 MCP_NAMESPACE_BEGIN
 
+struct MessageBase;
+
 // Transport events
 enum class ETransportState : uint8_t
 {
@@ -41,9 +48,35 @@ struct TransportOptions
 
 struct StdioClientTransportOptions final : TransportOptions
 {
+	static constexpr std::chrono::microseconds DEFAULT_FLUSH_LATENCY{ 0 };
+	static constexpr std::size_t DEFAULT_MAX_BATCH_BYTES{ 256 * 1024 };
+
 	bool UseStderr{ false };
 	std::string Command;
 	std::vector<std::string> Arguments;
+	std::chrono::microseconds FlushLatency{ DEFAULT_FLUSH_LATENCY }; // How long outbound writes wait to be batched
+	std::size_t MaxBatchBytes{ DEFAULT_MAX_BATCH_BYTES };			 // Upper bound on bytes per batched write
+	// Binary encodings offered to the server during initialize, in order of preference. Empty keeps to JSON.
+	std::vector<EWireFormat> WireFormats;
+};
+
+struct StdioServerTransportOptions final : TransportOptions
+{
+	static constexpr std::chrono::microseconds DEFAULT_FLUSH_LATENCY{ 0 };
+	static constexpr std::size_t DEFAULT_MAX_BATCH_BYTES{ 256 * 1024 };
+
+	std::chrono::microseconds FlushLatency{ DEFAULT_FLUSH_LATENCY }; // How long outbound writes wait to be batched
+	std::size_t MaxBatchBytes{ DEFAULT_MAX_BATCH_BYTES };			 // Upper bound on bytes per batched write
+	// Binary encodings accepted when a client offers them during initialize. Empty keeps to JSON.
+	std::vector<EWireFormat> WireFormats;
+};
+
+// What the server does when an event stream's outbound queue is full
+enum class ESlowConsumerPolicy : uint8_t
+{
+	DropOldestNotification, // Evict the oldest queued notification; responses are never dropped
+	CoalesceProgress,		// Replace queued progress for the same token, otherwise drop the oldest notification
+	Disconnect				// Close the stream
 };
 
 struct HTTPTransportOptions final : TransportOptions
@@ -53,6 +86,11 @@ struct HTTPTransportOptions final : TransportOptions
 	static constexpr std::string_view DEFAULT_HOST{ "localhost" };
 	static constexpr uint16_t DEFAULT_PORT{ 8080 };
 	static constexpr std::string_view DEFAULT_PATH{ "/mcp" };
+	static constexpr std::size_t DEFAULT_MAX_CONNECTIONS{ 8 };
+	static constexpr std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT{ 30000 };
+	static constexpr std::size_t DEFAULT_MAX_REQUESTS_PER_CONNECTION{ 1000 };
+	static constexpr std::size_t DEFAULT_MAX_QUEUED_EVENTS{ 1024 };
+	static constexpr std::size_t DEFAULT_MAX_QUEUED_BYTES{ 8 * 1024 * 1024 };
 
 	bool UseHTTPS = false;
 	uint16_t Port = DEFAULT_PORT;
@@ -61,6 +99,16 @@ struct HTTPTransportOptions final : TransportOptions
 	std::chrono::milliseconds ConnectTimeout{ DEFAULT_CONNECT_TIMEOUT };
 	std::chrono::milliseconds RequestTimeout{ DEFAULT_REQUEST_TIMEOUT };
 	EProtocolVersion ProtocolVersion{ EProtocolVersion::V2025_03_26 };
+
+	// Client keep-alive connection pool
+	std::size_t MaxConnections{ DEFAULT_MAX_CONNECTIONS };
+	std::chrono::milliseconds IdleTimeout{ DEFAULT_IDLE_TIMEOUT };
+	std::size_t MaxRequestsPerConnection{ DEFAULT_MAX_REQUESTS_PER_CONNECTION };
+
+	// Server per-stream outbound queue limits
+	std::size_t MaxQueuedEventsPerStream{ DEFAULT_MAX_QUEUED_EVENTS };
+	std::size_t MaxQueuedBytesPerStream{ DEFAULT_MAX_QUEUED_BYTES };
+	ESlowConsumerPolicy SlowConsumerPolicy{ ESlowConsumerPolicy::CoalesceProgress };
 };
 
 // Transport interface
@@ -79,16 +127,34 @@ public:
 	virtual void TransmitMessage(const JSONData& InMessage,
 		const std::optional<std::vector<ConnectionID>>& InConnectionIDs)
 		= 0;
+	/**
+	 * Send a message the protocol built itself. Transports override this to serialize it straight into their output
+	 * buffer with their framing around it; the default converts it to a document and sends that.
+	 */
+	virtual void TransmitMessage(const MessageBase& InMessage,
+		const std::optional<std::vector<ConnectionID>>& InConnectionIDs);
 	[[nodiscard]] virtual std::string GetConnectionInfo() const = 0;
+	// How long requests sent over this transport may wait for a response; empty leaves it to the protocol
+	[[nodiscard]] virtual std::optional<std::chrono::milliseconds> GetRequestTimeout() const { return std::nullopt; }
+	// Binary encodings this transport can switch to, in order of preference; empty if it only speaks JSON
+	[[nodiscard]] virtual std::vector<EWireFormat> GetWireFormats() const { return {}; }
+	// Encode outbound messages as InFormat from now on. Inbound frames name their own encoding, so only the sender
+	// has to switch.
+	virtual void SetWireFormat(const EWireFormat InFormat) { (void)InFormat; }
 
 	// Default Implementations
 	[[nodiscard]] bool IsConnected() const;
 	[[nodiscard]] ETransportState GetState() const;
 	void SetState(ETransportState InNewState);
 
-	void SetMessageRouter(std::function<void(const JSONData&)> InRouter);
+	// Receives every inbound message or batch with the connection it arrived on, if the transport serves several.
+	// Text is handed over, not copied, and is only decoded once it has been routed.
+	using MessageRouter = std::function<void(InboundMessage, const std::optional<ConnectionID>&)>;
+
+	void SetMessageRouter(MessageRouter InRouter);
 
-	void CallMessageRouter(const JSONData& InMessage) const;
+	void CallMessageRouter(InboundMessage InMessage,
+		const std::optional<ConnectionID>& InConnectionID = std::nullopt) const;
 
 	// Connection management
 	void RegisterConnection(const ConnectionID& InConnectionID);
@@ -97,8 +163,9 @@ public:
 	[[nodiscard]] std::vector<ConnectionID> GetActiveConnections() const;
 
 private:
-	ETransportState m_CurrentState{ ETransportState::Disconnected };
-	std::function<void(const JSONData&)> m_MessageRouter;
+	std::atomic<ETransportState> m_CurrentState{ ETransportState::Disconnected };
+	MessageRouter m_MessageRouter;
+	mutable std::mutex m_ConnectionsMutex;
 	std::unordered_set<ConnectionID> m_ActiveConnections;
 };
 
@@ -125,7 +192,10 @@ public:
 	// Convenience factory methods
 	[[nodiscard]] static std::unique_ptr<ITransport> CreateStdioClientTransport(
 		const StdioClientTransportOptions& InOptions);
+	[[nodiscard]] static std::unique_ptr<ITransport> CreateStdioServerTransport(
+		const StdioServerTransportOptions& InOptions);
 	[[nodiscard]] static std::unique_ptr<ITransport> CreateHTTPTransport(const HTTPTransportOptions& InOptions);
+	[[nodiscard]] static std::unique_ptr<ITransport> CreateHTTPServerTransport(const HTTPTransportOptions& InOptions);
 };
 
 MCP_NAMESPACE_END
\ No newline at end of file
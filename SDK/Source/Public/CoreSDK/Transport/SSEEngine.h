@@ -0,0 +1,168 @@
+#pragma once
+
+#include <Poco/Net/StreamSocket.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "CoreSDK/Common/Macros.h"
+#include "CoreSDK/Transport/ITransport.h"
+#include "JSONProxy.h"
+#include "Utilities/IO/IOReactor.h"
+
+MCP_NAMESPACE_BEGIN
+
+enum class ESSEEventKind : uint8_t
+{
+	Message,	  // Requests and responses, never dropped
+	Notification, // May be dropped under backpressure
+	Progress	  // Progress notification, may be coalesced with a newer one for the same token
+};
+
+// Why a stream was closed, as reported to the disconnect callback
+enum class ESSECloseReason : uint8_t
+{
+	Removed,	 // RemoveClient() or CloseAll() was called
+	PeerLeft,	 // The peer closed the connection or it failed
+	SlowConsumer // Sending to the stream failed, usually because it fell behind and the policy gave up on it
+};
+
+// A formatted event, shared by every stream it is queued on
+struct SSEEvent
+{
+	std::string Data;
+	ESSEEventKind Kind{ ESSEEventKind::Message };
+	std::string ProgressToken;
+};
+
+struct SSEClientStats
+{
+	std::size_t QueuedEvents{ 0 };
+	std::size_t QueuedBytes{ 0 };
+	uint64_t DroppedEvents{ 0 };
+	uint64_t CoalescedEvents{ 0 };
+};
+
+struct SSEEngineStats
+{
+	std::size_t Clients{ 0 };
+	std::size_t QueuedEvents{ 0 };
+	std::size_t QueuedBytes{ 0 };
+	std::size_t MaxQueueDepth{ 0 };
+	uint64_t DroppedEvents{ 0 };
+	uint64_t CoalescedEvents{ 0 };
+	uint64_t SlowConsumerDisconnects{ 0 };
+};
+
+/**
+ * Owns the sockets of Server-Sent Events streams once their response headers have been sent.
+ * Streams are serviced by an IOReactor instead of a request thread each: an idle stream costs one watched socket,
+ * and a stream is only woken when its outbound queue has data or the peer goes away. Events are queued as shared,
+ * immutable payloads so a broadcast formats the event once regardless of how many streams receive it.
+ * Every stream's queue is bounded; a stream that falls behind is handled according to the slow-consumer policy
+ * without holding up senders or other streams.
+ */
+class SSEEngine
+{
+public:
+	using Payload = std::shared_ptr<const SSEEvent>;
+	using DisconnectCallback = std::function<void(const std::string&, ESSECloseReason)>;
+
+	// Framing around the data of every event
+	static constexpr std::string_view EVENT_PREFIX{ "data: " };
+	static constexpr std::string_view EVENT_SUFFIX{ "\n\n" };
+
+	SSEEngine(std::size_t InMaxQueuedEvents,
+		std::size_t InMaxQueuedBytes,
+		ESlowConsumerPolicy InPolicy,
+		IOReactor& InReactor = IOReactor::Shared());
+	~SSEEngine() noexcept;
+	SSEEngine(const SSEEngine&) = delete;
+	SSEEngine(SSEEngine&&) = delete;
+	SSEEngine& operator=(const SSEEngine&) = delete;
+	SSEEngine& operator=(SSEEngine&&) = delete;
+
+	// Format a payload as a single SSE "data:" event
+	[[nodiscard]] static Payload MakeEvent(std::string_view InData,
+		ESSEEventKind InKind = ESSEEventKind::Message,
+		std::string InProgressToken = {});
+
+	// Format a JSON-RPC message, classifying it for the slow-consumer policy
+	[[nodiscard]] static Payload MakeMessageEvent(const JSONData& InMessage);
+
+	// Invoked once for every stream that closes, with whether the peer left, it was removed or it fell behind
+	void SetDisconnectCallback(DisconnectCallback InCallback);
+
+	/**
+	 * Take over a stream whose headers have already been written.
+	 * @param InClientID Identifier used to address the stream
+	 * @param InSocket The detached connection socket
+	 * @return False if the socket could not be watched, in which case it has been closed
+	 */
+	bool AddClient(const std::string& InClientID, Poco::Net::StreamSocket InSocket);
+	void RemoveClient(const std::string& InClientID);
+	void CloseAll();
+
+	// Queue an event on one stream. Returns false if the stream does not exist.
+	bool Send(const std::string& InClientID, const Payload& InEvent);
+	void Broadcast(const Payload& InEvent);
+
+	[[nodiscard]] std::size_t GetClientCount() const;
+	[[nodiscard]] std::optional<SSEClientStats> GetClientStats(const std::string& InClientID) const;
+	[[nodiscard]] SSEEngineStats GetStats() const;
+
+private:
+	struct SSEClient
+	{
+		std::string ClientID;
+		Poco::Net::StreamSocket Socket;
+		Poco::Net::poco_socket_t Handle{};
+		std::chrono::steady_clock::time_point ConnectedTime;
+
+		mutable std::mutex Mutex;
+		std::deque<Payload> Queue;
+		std::size_t QueuedBytes{ 0 };
+		std::size_t FrontOffset{ 0 }; // Bytes of Queue.front() already written
+		bool IsFlushing{ false };	  // Writable interest is registered
+		bool IsClosed{ false };
+		uint64_t DroppedEvents{ 0 };
+		uint64_t CoalescedEvents{ 0 };
+	};
+
+	// Queue an event and make sure the stream will be flushed; called with the client mutex held.
+	// False if the stream has to be closed.
+	bool Enqueue(SSEClient& InClient, const Payload& InEvent);
+	// Apply the slow-consumer policy until InIncoming fits. False if the stream has to be closed.
+	bool MakeRoom(SSEClient& InClient, const SSEEvent& InIncoming);
+	void OnSocketEvent(const std::shared_ptr<SSEClient>& InClient, EIOEvent InEvents);
+	// Write as much of the queue as the socket accepts. False if the stream failed.
+	static bool Flush(SSEClient& InClient);
+	void Close(const std::shared_ptr<SSEClient>& InClient, ESSECloseReason InReason);
+
+	IOReactor& m_Reactor;
+	bool m_UseReactor;
+	std::size_t m_MaxQueuedEvents;
+	std::size_t m_MaxQueuedBytes;
+	ESlowConsumerPolicy m_Policy;
+
+	mutable std::shared_mutex m_Mutex;
+	std::unordered_map<std::string, std::shared_ptr<SSEClient>> m_Clients;
+	DisconnectCallback m_OnDisconnect;
+
+	std::atomic<uint64_t> m_DroppedEvents{ 0 };
+	std::atomic<uint64_t> m_CoalescedEvents{ 0 };
+	std::atomic<uint64_t> m_SlowConsumerDisconnects{ 0 };
+};
+
+MCP_NAMESPACE_END
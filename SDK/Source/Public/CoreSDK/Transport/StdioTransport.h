@@ -1,16 +1,18 @@
 #pragma once
 
 #include <Poco/Pipe.h>
-#include <Poco/PipeStream.h>
 #include <Poco/Process.h>
 
-#include <future>
-#include <mutex>
-#include <thread>
+#include <atomic>
+#include <string_view>
+#include <vector>
 
 #include "CoreSDK/Common/Macros.h"
 #include "CoreSDK/Transport/ITransport.h"
+#include "CoreSDK/Messages/MessageBase.h"
 #include "JSONProxy.h"
+#include "Utilities/IO/CoalescingWriter.h"
+#include "Utilities/IO/StdioReader.h"
 
 MCP_NAMESPACE_BEGIN
 
@@ -24,19 +26,20 @@ public:
 	VoidTask Connect() override;
 	VoidTask Disconnect() override;
 
-	void run();
-
 	void TransmitMessage(const JSONData& InMessage,
 		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
+	void TransmitMessage(const MessageBase& InMessage,
+		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
 
 	std::string GetConnectionInfo() const override;
-
-protected:
-	void ReaderThread(std::stop_token InStopToken);
+	std::vector<EWireFormat> GetWireFormats() const override;
+	void SetWireFormat(EWireFormat InFormat) override;
 
 private:
-	void ProcessIncomingData();
-	void ProcessLine(const std::string& InLine);
+	// A line of JSON text or a binary frame
+	void ProcessFrame(std::string_view InFrame);
+	// Serialize a message into a recycled buffer of the writer and queue it
+	template <typename SerializeFunction> void Send(const SerializeFunction& InSerialize);
 	void Cleanup();
 
 	StdioClientTransportOptions m_Options;
@@ -44,46 +47,41 @@ private:
 	std::unique_ptr<Poco::Pipe> m_StdinPipe;
 	std::unique_ptr<Poco::Pipe> m_StdoutPipe;
 	std::unique_ptr<Poco::Pipe> m_StderrPipe;
-	std::unique_ptr<Poco::PipeOutputStream> m_StdinStream;
-	std::unique_ptr<Poco::PipeInputStream> m_StdoutStream;
-	std::unique_ptr<Poco::PipeInputStream> m_StderrStream;
-
-	bool m_ShouldStop{ false };
-	std::jthread m_ReadThread;
-	std::string m_Buffer;
-
-	mutable std::mutex m_WriteMutex;
+	std::unique_ptr<CoalescingWriter> m_StdinWriter;
+	std::unique_ptr<StdioReader> m_StdoutReader;
+	std::unique_ptr<StdioReader> m_StderrReader;
+	std::atomic<EWireFormat> m_WireFormat{ EWireFormat::JSON };
 };
 
 class StdioServerTransport final : public ITransport
 {
 public:
-	StdioServerTransport();
+	explicit StdioServerTransport(StdioServerTransportOptions InOptions = {});
 	~StdioServerTransport() noexcept override;
 
 	// ITransport interface
 	VoidTask Connect() override;
 	VoidTask Disconnect() override;
 
-	void run();
-
 	void TransmitMessage(const JSONData& InMessage,
 		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
+	void TransmitMessage(const MessageBase& InMessage,
+		const std::optional<std::vector<ConnectionID>>& InConnectionIDs) override;
 
 	std::string GetConnectionInfo() const override;
-
-protected:
-	void ReaderThread(std::stop_token InStopToken);
+	std::vector<EWireFormat> GetWireFormats() const override;
+	void SetWireFormat(EWireFormat InFormat) override;
 
 private:
-	void ProcessIncomingData();
-	void ProcessLine(const std::string& InLine);
-
-	bool m_ShouldStop{ false };
-	std::jthread m_ReadThread;
-	std::string m_Buffer;
-
-	mutable std::mutex m_WriteMutex;
+	// A line of JSON text or a binary frame
+	void ProcessFrame(std::string_view InFrame);
+	// Serialize a message into a recycled buffer of the writer and queue it
+	template <typename SerializeFunction> void Send(const SerializeFunction& InSerialize);
+
+	StdioServerTransportOptions m_Options;
+	std::unique_ptr<StdioReader> m_StdinReader;
+	std::unique_ptr<CoalescingWriter> m_StdoutWriter;
+	std::atomic<EWireFormat> m_WireFormat{ EWireFormat::JSON };
 };
 
 MCP_NAMESPACE_END
\ No newline at end of file
@@ -2,7 +2,10 @@
 
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <variant>
 
 #include "../CoreSDK/Common/Macros.h"
 #include "../Utilities/ThirdParty/json.hpp"
@@ -14,7 +17,15 @@ template <typename T> struct nlohmann::adl_serializer<std::unique_ptr<T>>
 	{
 		if (ptr)
 		{
-			j = *ptr; // If the pointer is not null, serialize the object it points to
+			// Serialize the object it points to, as its dynamic type when it has one
+			if constexpr (requires { ptr->SerializeTo(j); })
+			{
+				ptr->SerializeTo(j);
+			}
+			else
+			{
+				j = *ptr;
+			}
 		}
 		else
 		{
@@ -36,6 +47,45 @@ template <typename T> struct nlohmann::adl_serializer<std::unique_ptr<T>>
 	}
 };
 
+// Serialize a std::variant as its active alternative. On the way in the alternatives are tried in declaration order and
+// the first one that parses wins, so list the most specific alternative first.
+template <typename... Types> struct nlohmann::adl_serializer<std::variant<Types...>>
+{
+	static void to_json(json& j, const std::variant<Types...>& value)
+	{
+		std::visit([&j](const auto& alternative) { j = alternative; }, value);
+	}
+
+	static void from_json(const json& j, std::variant<Types...>& value)
+	{
+		if (!TryAlternatives(j, value, std::index_sequence_for<Types...>{}))
+		{
+			throw json::other_error::create(501, "no variant alternative matches the JSON value", &j);
+		}
+	}
+
+private:
+	template <std::size_t... Indices>
+	static bool TryAlternatives(const json& j, std::variant<Types...>& value, std::index_sequence<Indices...>)
+	{
+		return (TryAlternative<Indices>(j, value) || ...);
+	}
+
+	template <std::size_t Index> static bool TryAlternative(const json& j, std::variant<Types...>& value)
+	{
+		try
+		{
+			auto alternative = j.template get<std::variant_alternative_t<Index, std::variant<Types...>>>();
+			value.template emplace<Index>(std::move(alternative));
+			return true;
+		}
+		catch (const json::exception&)
+		{
+			return false;
+		}
+	}
+};
+
 MCP_NAMESPACE_BEGIN
 
 // Concept: checks if a type is a nlohmann::basic_json specialization
@@ -92,6 +142,26 @@ concept IsOptional = requires { typename T::value_type; }
 				JSON_J.at(json_key).get_to(JSON_T.Member);      \
 			}                                                   \
 		}                                                       \
+		static void read_json(auto& JSON_R, auto& JSON_T)       \
+		{                                                       \
+			ReadJSON(JSON_R, JSON_T.Member);                    \
+		}                                                       \
+		static constexpr bool is_required(const auto& JSON_T)   \
+		{                                                       \
+			return !IsOptional<decltype(JSON_T.Member)>;        \
+		}                                                       \
+		static void write_json(auto& JSON_W, const auto& JSON_T) \
+		{                                                       \
+			if constexpr (IsOptional<decltype(JSON_T.Member)>)  \
+			{                                                   \
+				if (!JSON_T.Member.has_value())                 \
+				{                                               \
+					return;                                     \
+				}                                               \
+			}                                                   \
+			JSON_W.Key(json_key);                               \
+			WriteJSON(JSON_W, JSON_T.Member);                   \
+		}                                                       \
 	} VarName{};
 
 // Usage macros for JSON_KEY tokens
@@ -99,13 +169,37 @@ concept IsOptional = requires { typename T::value_type; }
 #define USE_JKEY_FROM_JSON(KeyToken) KeyToken.from_json(JSON_J, JSON_T);
 
 // Combined DEFINE_TYPE_JSON that works with JSON_KEY tokens
-#define DEFINE_TYPE_JSON(Type, ...)                       \
-	DEFINE_TO_JSON(Type, APPLY_TO_JSON_KEYS(__VA_ARGS__)) \
-	DEFINE_FROM_JSON(Type, APPLY_FROM_JSON_KEYS(__VA_ARGS__))
+#define DEFINE_TYPE_JSON(Type, ...)                           \
+	DEFINE_TO_JSON(Type, APPLY_TO_JSON_KEYS(__VA_ARGS__))     \
+	DEFINE_FROM_JSON(Type, APPLY_FROM_JSON_KEYS(__VA_ARGS__)) \
+	DEFINE_JSON_KEYS(__VA_ARGS__)
+
+#define DEFINE_TYPE_JSON_DERIVED(Type, BaseType, ...)                           \
+	DEFINE_TO_JSON_DERIVED(Type, BaseType, APPLY_TO_JSON_KEYS(__VA_ARGS__))     \
+	DEFINE_FROM_JSON_DERIVED(Type, BaseType, APPLY_FROM_JSON_KEYS(__VA_ARGS__)) \
+	DEFINE_JSON_KEYS_DERIVED(BaseType, __VA_ARGS__)                             \
+	DEFINE_SERIALIZE_TO()
+
+// For the root of a hierarchy that is held through base pointers, such as messages and their params. SerializeTo
+// then writes the dynamic type; DEFINE_TYPE_JSON_DERIVED overrides it in every type below.
+#define DEFINE_TYPE_JSON_POLYMORPHIC(Type, ...) \
+	DEFINE_TYPE_JSON(Type, __VA_ARGS__)         \
+	DEFINE_SERIALIZE_TO(virtual)
+
+#define DEFINE_SERIALIZE_TO(Specifier)                                                          \
+	Specifier void SerializeTo(MCP::JSONData& OutJSON) const                                    \
+	{                                                                                           \
+		OutJSON = MCP::JSONData::object();                                                      \
+		to_json(OutJSON, *this);                                                                \
+	}                                                                                           \
+	Specifier void SerializeTo(MCP::JSONWriter& OutWriter) const { WriteKeyedObject(OutWriter, *this); }
 
-#define DEFINE_TYPE_JSON_DERIVED(Type, BaseType, ...)                       \
-	DEFINE_TO_JSON_DERIVED(Type, BaseType, APPLY_TO_JSON_KEYS(__VA_ARGS__)) \
-	DEFINE_FROM_JSON_DERIVED(Type, BaseType, APPLY_FROM_JSON_KEYS(__VA_ARGS__))
+// Every JSON_KEY of a type, base keys first, so readers and writers can walk its fields without a document
+#define DEFINE_JSON_KEYS(...) \
+	static constexpr auto JSONKeys() { return std::tuple{ __VA_ARGS__ }; }
+
+#define DEFINE_JSON_KEYS_DERIVED(BaseType, ...) \
+	static constexpr auto JSONKeys() { return std::tuple_cat(BaseType::JSONKeys(), std::tuple{ __VA_ARGS__ }); }
 
 // Helper macros to apply operations to all JSON_KEY tokens
 #define APPLY_TO_JSON_KEYS(...) FOR_EACH_JSON_KEY(USE_JKEY_TO_JSON, __VA_ARGS__)
@@ -182,9 +276,9 @@ concept IsEnumType = std::is_enum_v<EnumerationType>;
 		requires IsBasicJSON<BasicJSONType> && IsEnumType<EnumerationType>                                          \
 	inline void to_json(BasicJSONType& jsonObject, const EnumerationType& enumValue)                                \
 	{                                                                                                               \
-		static constexpr auto enumMappings = std::to_array<std::pair<EnumerationType, BasicJSONType>>(__VA_ARGS__); \
-		if constexpr (auto mappingIterator = std::ranges::find_if(enumMappings,                                     \
-						  [enumValue](const auto& enumJsonPair) { return enumJsonPair.first == enumValue; });       \
+		static const std::pair<EnumerationType, BasicJSONType> enumMappings[] = { __VA_ARGS__ };                    \
+		if (auto mappingIterator = std::ranges::find_if(enumMappings,                                               \
+				[enumValue](const auto& enumJsonPair) { return enumJsonPair.first == enumValue; });                 \
 			mappingIterator != std::ranges::end(enumMappings))                                                      \
 		{                                                                                                           \
 			jsonObject = mappingIterator->second;                                                                   \
@@ -198,9 +292,9 @@ concept IsEnumType = std::is_enum_v<EnumerationType>;
 		requires IsBasicJSON<BasicJSONType> && IsEnumType<EnumerationType>                                          \
 	inline void from_json(const BasicJSONType& jsonObject, EnumerationType& enumValue)                              \
 	{                                                                                                               \
-		static constexpr auto enumMappings = std::to_array<std::pair<EnumerationType, BasicJSONType>>(__VA_ARGS__); \
-		if constexpr (auto mappingIterator = std::ranges::find_if(enumMappings,                                     \
-						  [&jsonObject](const auto& enumJsonPair) { return enumJsonPair.second == jsonObject; });   \
+		static const std::pair<EnumerationType, BasicJSONType> enumMappings[] = { __VA_ARGS__ };                    \
+		if (auto mappingIterator = std::ranges::find_if(enumMappings,                                               \
+				[&jsonObject](const auto& enumJsonPair) { return enumJsonPair.second == jsonObject; });             \
 			mappingIterator != std::ranges::end(enumMappings))                                                      \
 		{                                                                                                           \
 			enumValue = mappingIterator->first;                                                                     \
@@ -213,6 +307,13 @@ concept IsEnumType = std::is_enum_v<EnumerationType>;
 
 using JSONData = nlohmann::json;
 
+template <typename T>
+concept HasJSONKeys = requires { T::JSONKeys(); };
+
+// Defined in JSONWriter.h, which every header declaring a polymorphic JSON type includes
+class JSONWriter;
+template <HasJSONKeys T> void WriteKeyedObject(JSONWriter& InWriter, const T& InValue);
+
 // JSON Schema
 struct JSONSchema
 {
@@ -3,12 +3,21 @@
 #include <Poco/URI.h>
 
 #include "../CoreSDK/Common/Macros.h"
+#include "JSONProxy.h"
 
 template <> struct std::hash<Poco::URI>
 {
 	std::size_t operator()(const Poco::URI& InURI) const noexcept { return std::hash<string>{}(InURI.toString()); }
 };
 
+// URIs travel as their string form
+template <> struct nlohmann::adl_serializer<Poco::URI>
+{
+	static void to_json(json& j, const Poco::URI& uri) { j = uri.toString(); }
+
+	static void from_json(const json& j, Poco::URI& uri) { uri = Poco::URI(j.get<std::string>()); }
+};
+
 MCP_NAMESPACE_BEGIN
 
 // TODO: @HalcyonOmega create URI, URIFile, & URITemplate classes
@@ -0,0 +1,285 @@
+#include "Utilities/Async/FrameAllocator.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+MCP_NAMESPACE_BEGIN
+
+namespace
+{
+	// Precedes every frame so it can be returned to where it came from; keeps the frame at the default alignment
+	struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameHeader
+	{
+		FrameArena* Arena{ nullptr };
+	};
+
+	constexpr std::size_t HEADER_SIZE{ sizeof(FrameHeader) };
+	constexpr std::size_t CLASS_COUNT{ std::countr_zero(FrameAllocator::MAX_CLASS_SIZE)
+		- std::countr_zero(FrameAllocator::MIN_CLASS_SIZE) + 1 };
+
+	[[nodiscard]] std::size_t GetClassIndex(const std::size_t InBlockSize)
+	{
+		const std::size_t ClassSize = std::bit_ceil(std::max(InBlockSize, FrameAllocator::MIN_CLASS_SIZE));
+		return static_cast<std::size_t>(std::countr_zero(ClassSize) - std::countr_zero(FrameAllocator::MIN_CLASS_SIZE));
+	}
+
+	[[nodiscard]] constexpr std::size_t GetClassSize(const std::size_t InClassIndex)
+	{
+		return FrameAllocator::MIN_CLASS_SIZE << InClassIndex;
+	}
+
+	struct ThreadCache;
+
+	// Every live thread cache, and the counts of those that have gone
+	struct CacheRegistry
+	{
+		std::mutex Mutex;
+		std::vector<const ThreadCache*> Caches;
+		FrameAllocatorStats Retired;
+	};
+
+	// Never destroyed: worker threads of static pools can still exit during static destruction
+	CacheRegistry& GetRegistry()
+	{
+		static CacheRegistry* Instance = new CacheRegistry;
+		return *Instance;
+	}
+
+	// Stays valid after the cache itself is gone, so frames freed late in thread exit go straight to the heap
+	thread_local bool t_CacheDestroyed{ false };
+	thread_local FrameArena* t_CurrentArena{ nullptr };
+
+	struct ThreadCache
+	{
+		struct FreeBlock
+		{
+			FreeBlock* Next;
+		};
+
+		std::array<FreeBlock*, CLASS_COUNT> FreeLists{};
+		std::array<std::size_t, CLASS_COUNT> FreeCounts{};
+
+		// Only written by the owning thread; atomic so GetStats can read them from another
+		std::atomic<uint64_t> PoolHits{ 0 };
+		std::atomic<uint64_t> PoolMisses{ 0 };
+		std::atomic<uint64_t> ArenaFrames{ 0 };
+		std::atomic<uint64_t> Oversized{ 0 };
+
+		ThreadCache()
+		{
+			CacheRegistry& Registry = GetRegistry();
+			std::scoped_lock Lock(Registry.Mutex);
+			Registry.Caches.push_back(this);
+		}
+
+		~ThreadCache() noexcept
+		{
+			t_CacheDestroyed = true;
+
+			for (FreeBlock* Head : FreeLists)
+			{
+				while (Head != nullptr)
+				{
+					::operator delete(std::exchange(Head, Head->Next));
+				}
+			}
+
+			CacheRegistry& Registry = GetRegistry();
+			std::scoped_lock Lock(Registry.Mutex);
+			std::erase(Registry.Caches, this);
+			Registry.Retired.PoolHits += PoolHits.load(std::memory_order_relaxed);
+			Registry.Retired.PoolMisses += PoolMisses.load(std::memory_order_relaxed);
+			Registry.Retired.ArenaFrames += ArenaFrames.load(std::memory_order_relaxed);
+			Registry.Retired.Oversized += Oversized.load(std::memory_order_relaxed);
+		}
+
+		ThreadCache(const ThreadCache&) = delete;
+		ThreadCache(ThreadCache&&) = delete;
+		ThreadCache& operator=(const ThreadCache&) = delete;
+		ThreadCache& operator=(ThreadCache&&) = delete;
+
+		// No read-modify-write: only this thread writes the counter, so it costs no more than a plain increment
+		static void Count(std::atomic<uint64_t>& InCounter)
+		{
+			InCounter.store(InCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] void* Pop(const std::size_t InClassIndex)
+		{
+			FreeBlock* Block = FreeLists[InClassIndex];
+			if (Block == nullptr)
+			{
+				return nullptr;
+			}
+			FreeLists[InClassIndex] = Block->Next;
+			--FreeCounts[InClassIndex];
+			return Block;
+		}
+
+		[[nodiscard]] bool Push(const std::size_t InClassIndex, void* InBlock)
+		{
+			if (FreeCounts[InClassIndex] >= FrameAllocator::MAX_CACHED_PER_CLASS)
+			{
+				return false;
+			}
+			FreeLists[InClassIndex] = ::new (InBlock) FreeBlock{ FreeLists[InClassIndex] };
+			++FreeCounts[InClassIndex];
+			return true;
+		}
+	};
+
+	[[nodiscard]] ThreadCache* GetThreadCache()
+	{
+		if (t_CacheDestroyed)
+		{
+			return nullptr;
+		}
+		thread_local ThreadCache Cache;
+		return &Cache;
+	}
+
+	// Count on the thread's cache, or straight into the retired totals once it is gone
+	void CountEvent(ThreadCache* InCache, std::atomic<uint64_t> ThreadCache::* InCounter,
+		uint64_t FrameAllocatorStats::* InRetired)
+	{
+		if (InCache != nullptr)
+		{
+			ThreadCache::Count(InCache->*InCounter);
+			return;
+		}
+		CacheRegistry& Registry = GetRegistry();
+		std::scoped_lock Lock(Registry.Mutex);
+		++(Registry.Retired.*InRetired);
+	}
+} // namespace
+
+// FrameArena Implementation
+FrameArena::Scope::Scope(const std::size_t InCapacity)
+{
+	if (InCapacity == 0)
+	{
+		return;
+	}
+	m_Arena = new FrameArena(InCapacity);
+	m_Previous = std::exchange(t_CurrentArena, m_Arena);
+}
+
+FrameArena::Scope::~Scope() noexcept
+{
+	if (m_Arena == nullptr)
+	{
+		return;
+	}
+	t_CurrentArena = m_Previous;
+	m_Arena->Release();
+}
+
+FrameArena::FrameArena(const std::size_t InCapacity)
+	: m_Buffer(std::make_unique_for_overwrite<std::byte[]>(InCapacity)),
+	  m_Capacity(InCapacity)
+{}
+
+void* FrameArena::TryAllocate(const std::size_t InSize)
+{
+	constexpr std::size_t ALIGNMENT{ __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+	const std::size_t Offset = (m_Used + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	if (Offset > m_Capacity || m_Capacity - Offset < InSize)
+	{
+		return nullptr;
+	}
+	m_Used = Offset + InSize;
+	m_References.fetch_add(1, std::memory_order_relaxed);
+	return m_Buffer.get() + Offset;
+}
+
+void FrameArena::Release() noexcept
+{
+	if (m_References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		delete this;
+	}
+}
+
+// FrameAllocator Implementation
+void* FrameAllocator::Allocate(const std::size_t InSize)
+{
+	const std::size_t BlockSize = InSize + HEADER_SIZE;
+	ThreadCache* Cache = GetThreadCache();
+
+	if (t_CurrentArena != nullptr)
+	{
+		if (void* Block = t_CurrentArena->TryAllocate(BlockSize))
+		{
+			CountEvent(Cache, &ThreadCache::ArenaFrames, &FrameAllocatorStats::ArenaFrames);
+			::new (Block) FrameHeader{ t_CurrentArena };
+			return static_cast<std::byte*>(Block) + HEADER_SIZE;
+		}
+	}
+
+	void* Block{ nullptr };
+	if (BlockSize > MAX_CLASS_SIZE)
+	{
+		CountEvent(Cache, &ThreadCache::Oversized, &FrameAllocatorStats::Oversized);
+		Block = ::operator new(BlockSize);
+	}
+	else
+	{
+		const std::size_t ClassIndex = GetClassIndex(BlockSize);
+		Block = Cache != nullptr ? Cache->Pop(ClassIndex) : nullptr;
+		if (Block != nullptr)
+		{
+			CountEvent(Cache, &ThreadCache::PoolHits, &FrameAllocatorStats::PoolHits);
+		}
+		else
+		{
+			CountEvent(Cache, &ThreadCache::PoolMisses, &FrameAllocatorStats::PoolMisses);
+			Block = ::operator new(GetClassSize(ClassIndex));
+		}
+	}
+
+	::new (Block) FrameHeader{};
+	return static_cast<std::byte*>(Block) + HEADER_SIZE;
+}
+
+void FrameAllocator::Deallocate(void* InFrame, const std::size_t InSize) noexcept
+{
+	void* Block = static_cast<std::byte*>(InFrame) - HEADER_SIZE;
+	if (FrameArena* Arena = static_cast<FrameHeader*>(Block)->Arena)
+	{
+		Arena->Release();
+		return;
+	}
+
+	const std::size_t BlockSize = InSize + HEADER_SIZE;
+	if (BlockSize <= MAX_CLASS_SIZE)
+	{
+		if (ThreadCache* Cache = GetThreadCache(); Cache != nullptr && Cache->Push(GetClassIndex(BlockSize), Block))
+		{
+			return;
+		}
+	}
+	::operator delete(Block);
+}
+
+FrameAllocatorStats FrameAllocator::GetStats()
+{
+	CacheRegistry& Registry = GetRegistry();
+	std::scoped_lock Lock(Registry.Mutex);
+
+	FrameAllocatorStats Stats = Registry.Retired;
+	for (const ThreadCache* Cache : Registry.Caches)
+	{
+		Stats.PoolHits += Cache->PoolHits.load(std::memory_order_relaxed);
+		Stats.PoolMisses += Cache->PoolMisses.load(std::memory_order_relaxed);
+		Stats.ArenaFrames += Cache->ArenaFrames.load(std::memory_order_relaxed);
+		Stats.Oversized += Cache->Oversized.load(std::memory_order_relaxed);
+	}
+	return Stats;
+}
+
+MCP_NAMESPACE_END
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "CoreSDK/Common/Macros.h"
+
+MCP_NAMESPACE_BEGIN
+
+struct FrameAllocatorStats
+{
+	uint64_t PoolHits{ 0 };	   // Frames served from a thread's free list
+	uint64_t PoolMisses{ 0 };  // Frames of a pooled size class that had to be allocated
+	uint64_t ArenaFrames{ 0 }; // Frames served from a per-request arena
+	uint64_t Oversized{ 0 };   // Frames too large to pool, allocated directly
+};
+
+/**
+ * Bump allocator for the coroutine frames of one request. Installed on a thread by a Scope, it serves every frame
+ * created there until the scope ends; the frames are never freed one by one, and the memory goes back in one piece
+ * once the scope has ended and the last of its frames is destroyed, on whichever thread that happens. Frames that do
+ * not fit in what is left fall back to the pool.
+ */
+class FrameArena
+{
+public:
+	static constexpr std::size_t DEFAULT_CAPACITY{ 16 * 1024 };
+
+	class Scope
+	{
+	public:
+		// A capacity of zero installs no arena
+		explicit Scope(std::size_t InCapacity = DEFAULT_CAPACITY);
+		~Scope() noexcept;
+		Scope(const Scope&) = delete;
+		Scope(Scope&&) = delete;
+		Scope& operator=(const Scope&) = delete;
+		Scope& operator=(Scope&&) = delete;
+
+	private:
+		FrameArena* m_Arena{ nullptr };
+		FrameArena* m_Previous{ nullptr };
+	};
+
+private:
+	explicit FrameArena(std::size_t InCapacity);
+
+	// Carve InSize bytes off the end of the arena, or nullptr if they do not fit
+	[[nodiscard]] void* TryAllocate(std::size_t InSize);
+	// Drop one reference, held by the scope and by every live frame; the last one frees the arena
+	void Release() noexcept;
+
+	std::unique_ptr<std::byte[]> m_Buffer;
+	std::size_t m_Capacity;
+	std::size_t m_Used{ 0 };
+	std::atomic<std::size_t> m_References{ 1 };
+
+	friend class FrameAllocator;
+};
+
+/**
+ * Where coroutine frames come from. A frame is taken from the thread's current FrameArena if there is one, and
+ * otherwise from a per-thread free list of its size class, so steady request traffic reuses frames instead of going
+ * to malloc. A frame freed on another thread joins that thread's free list. Frames larger than the biggest size class
+ * are allocated directly.
+ */
+class FrameAllocator
+{
+public:
+	// Size classes are powers of two from MIN_CLASS_SIZE to MAX_CLASS_SIZE, header included
+	static constexpr std::size_t MIN_CLASS_SIZE{ 64 };
+	static constexpr std::size_t MAX_CLASS_SIZE{ 8 * 1024 };
+	// Upper bound on free frames a thread keeps per size class; the rest go back to the heap
+	static constexpr std::size_t MAX_CACHED_PER_CLASS{ 256 };
+
+	[[nodiscard]] static void* Allocate(std::size_t InSize);
+	static void Deallocate(void* InFrame, std::size_t InSize) noexcept;
+
+	// Totals over every thread, including threads that have exited
+	[[nodiscard]] static FrameAllocatorStats GetStats();
+};
+
+/**
+ * Base for promise types whose frames should come from the FrameAllocator. The compiler looks up operator new and
+ * delete on the promise type when it allocates a coroutine frame.
+ */
+struct PooledFrame
+{
+	[[nodiscard]] static void* operator new(const std::size_t InSize) { return FrameAllocator::Allocate(InSize); }
+	static void operator delete(void* InFrame, const std::size_t InSize) noexcept
+	{
+		FrameAllocator::Deallocate(InFrame, InSize);
+	}
+};
+
+MCP_NAMESPACE_END
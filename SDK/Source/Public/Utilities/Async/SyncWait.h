@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/Async/TaskCombinators.h"
+
+MCP_NAMESPACE_BEGIN
+
+namespace TaskDetail
+{
+	// Completion flag shared by a blocked thread and the coroutine it waits for
+	struct SyncWaitState
+	{
+		std::mutex Mutex;
+		std::condition_variable Finished;
+		bool IsFinished{ false };
+
+		void Signal()
+		{
+			std::scoped_lock Lock(Mutex);
+			IsFinished = true;
+			Finished.notify_all();
+		}
+	};
+
+	// Fire-and-forget coroutine used to observe an awaitable from a plain thread
+	struct SyncWaitDriver
+	{
+		struct promise_type : PooledFrame
+		{
+			SyncWaitDriver get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	// Starts an awaitable and resumes the caller on completion without consuming its result
+	template <Awaitable T> struct CompletionAwaiter
+	{
+		T& Inner;
+
+		[[nodiscard]] bool await_ready() const { return Inner.await_ready(); }
+		[[nodiscard]] auto await_suspend(const std::coroutine_handle<> InAwaiter) const
+		{
+			return Inner.await_suspend(InAwaiter);
+		}
+		void await_resume() const noexcept {}
+	};
+
+	template <Awaitable T> SyncWaitDriver SignalOnCompletion(T& InAwaitable, std::shared_ptr<SyncWaitState> InState)
+	{
+		co_await CompletionAwaiter<T>{ InAwaitable };
+		InState->Signal();
+	}
+} // namespace TaskDetail
+
+/**
+ * Block the calling thread until an awaitable has finished, for code that cannot co_await: destructors, main() and
+ * other plain threads. The awaitable only resumes its waiter once it has reached its final suspension point, so it may
+ * be destroyed as soon as this returns. Must not be called from a coroutine the awaitable itself is waiting on.
+ * @return False on timeout, in which case the awaitable is still running and must be kept alive until it finishes
+ */
+template <TaskDetail::Awaitable T> bool SyncWaitFor(T& InAwaitable, const std::chrono::milliseconds InTimeout)
+{
+	const auto State = std::make_shared<TaskDetail::SyncWaitState>();
+	TaskDetail::SignalOnCompletion(InAwaitable, State);
+
+	std::unique_lock Lock(State->Mutex);
+	return State->Finished.wait_for(Lock, InTimeout, [&State] { return State->IsFinished; });
+}
+
+// Block until an awaitable has finished and return its result, rethrowing anything it threw
+template <TaskDetail::Awaitable T> TaskDetail::AwaitResult<T> SyncWait(T& InAwaitable)
+{
+	const auto State = std::make_shared<TaskDetail::SyncWaitState>();
+	TaskDetail::SignalOnCompletion(InAwaitable, State);
+	{
+		std::unique_lock Lock(State->Mutex);
+		State->Finished.wait(Lock, [&State] { return State->IsFinished; });
+	}
+	return InAwaitable.await_resume();
+}
+
+// Run a temporary task, such as `SyncWait(Server.Start())`, to completion
+template <TaskDetail::Awaitable T>
+	requires(!std::is_lvalue_reference_v<T> && !std::is_reference_v<TaskDetail::AwaitResult<T>>)
+TaskDetail::AwaitResult<T> SyncWait(T&& InAwaitable)
+{
+	T Awaitable = std::move(InAwaitable);
+	return SyncWait(Awaitable);
+}
+
+MCP_NAMESPACE_END
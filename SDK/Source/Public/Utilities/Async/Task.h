@@ -3,16 +3,44 @@
 #include <coroutine>
 #include <exception>
 #include <optional>
+#include <stdexcept>
 #include <utility>
 
 #include "CoreSDK/Common/Macros.h"
+#include "Utilities/Async/FrameAllocator.h"
 
 MCP_NAMESPACE_BEGIN
 
+namespace TaskDetail
+{
+	/**
+	 * Hands control straight to whoever awaited the finished task. The transfer replaces the task's frame on the
+	 * stack instead of nesting a resume inside it, so long chains of co_await run in constant stack depth, and the
+	 * task has reached its final suspension point before its awaiter runs.
+	 */
+	struct FinalAwaiter
+	{
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+
+		template <typename Promise>
+		[[nodiscard]] std::coroutine_handle<> await_suspend(
+			const std::coroutine_handle<Promise> InHandle) const noexcept
+		{
+			if (const std::coroutine_handle<> Awaiter = InHandle.promise().m_Awaiter)
+			{
+				return Awaiter;
+			}
+			return std::noop_coroutine();
+		}
+
+		void await_resume() const noexcept {}
+	};
+} // namespace TaskDetail
+
 // Primary template for coroutine tasks that return a value
 template <typename T> struct Task
 {
-	struct promise_type
+	struct promise_type : PooledFrame
 	{
 		std::optional<T> m_Result;
 		std::exception_ptr m_Exception;
@@ -29,15 +57,7 @@ template <typename T> struct Task
 			return {};
 		}
 
-		[[nodiscard]] std::suspend_always final_suspend() const noexcept
-		{
-			// Resume awaiter when this task completes
-			if (m_Awaiter)
-			{
-				m_Awaiter.resume();
-			}
-			return {};
-		}
+		[[nodiscard]] TaskDetail::FinalAwaiter final_suspend() const noexcept { return {}; }
 
 		void return_value(T Value) { m_Result = std::move(Value); }
 
@@ -76,19 +96,25 @@ template <typename T> struct Task
 	// Awaitable interface
 	[[nodiscard]] bool await_ready() const { return m_Handle && m_Handle.done(); }
 
-	void await_suspend(std::coroutine_handle<> InAwaiter)
+	[[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> InAwaiter) const
 	{
-		// Store awaiter to resume when this task completes
-		m_Handle.promise().m_Awaiter = InAwaiter;
-		// Resume this task if not started
-		if (m_Handle && !m_Handle.done())
+		// A moved-from task has nothing to run, so the awaiter carries straight on and await_resume reports it
+		if (!m_Handle)
 		{
-			m_Handle.resume();
+			return InAwaiter;
 		}
+
+		// Store awaiter to resume when this task completes, then start this task in place of the awaiter
+		m_Handle.promise().m_Awaiter = InAwaiter;
+		return m_Handle;
 	}
 
 	[[nodiscard]] T await_resume() const
 	{
+		if (!m_Handle)
+		{
+			throw std::logic_error("Awaited a task that holds no coroutine");
+		}
 		if (m_Handle.promise().m_Exception)
 		{
 			std::rethrow_exception(m_Handle.promise().m_Exception);
@@ -100,7 +126,7 @@ template <typename T> struct Task
 // Specialization for void return type
 template <> struct Task<void>
 {
-	struct promise_type
+	struct promise_type : PooledFrame
 	{
 		std::exception_ptr m_Exception;
 		std::coroutine_handle<> m_Awaiter;
@@ -116,15 +142,7 @@ template <> struct Task<void>
 			return {};
 		}
 
-		[[nodiscard]] std::suspend_always final_suspend() const noexcept
-		{
-			// Resume awaiter when this task completes
-			if (m_Awaiter)
-			{
-				m_Awaiter.resume();
-			}
-			return {};
-		}
+		[[nodiscard]] TaskDetail::FinalAwaiter final_suspend() const noexcept { return {}; }
 
 		void return_void() {}
 
@@ -163,19 +181,25 @@ template <> struct Task<void>
 	// Awaitable interface
 	[[nodiscard]] bool await_ready() const { return m_Handle && m_Handle.done(); }
 
-	void await_suspend(std::coroutine_handle<> InAwaiter) const
+	[[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> InAwaiter) const
 	{
-		// Store awaiter to resume when this task completes
-		m_Handle.promise().m_Awaiter = InAwaiter;
-		// Resume this task if not started
-		if (m_Handle && !m_Handle.done())
+		// A moved-from task has nothing to run, so the awaiter carries straight on and await_resume reports it
+		if (!m_Handle)
 		{
-			m_Handle.resume();
+			return InAwaiter;
 		}
+
+		// Store awaiter to resume when this task completes, then start this task in place of the awaiter
+		m_Handle.promise().m_Awaiter = InAwaiter;
+		return m_Handle;
 	}
 
 	void await_resume() const
 	{
+		if (!m_Handle)
+		{
+			throw std::logic_error("Awaited a task that holds no coroutine");
+		}
 		if (m_Handle.promise().m_Exception)
 		{
 			std::rethrow_exception(m_Handle.promise().m_Exception);
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/Async/FrameAllocator.h"
+#include "Utilities/Async/Task.h"
+#include "Utilities/Async/TimerWheel.h"
+
+MCP_NAMESPACE_BEGIN
+
+namespace TaskDetail
+{
+	template <typename T>
+	concept Awaitable = requires(T& InAwaitable) {
+		{ InAwaitable.await_ready() } -> std::convertible_to<bool>;
+		InAwaitable.await_resume();
+	};
+
+	// Awaitables that can be told to finish early, such as ResponseTask and TimerWheel::SleepAwaiter
+	template <typename T>
+	concept Cancellable = requires(T& InAwaitable) { InAwaitable.Cancel(); };
+
+	template <Awaitable T> using AwaitResult = decltype(std::declval<T&>().await_resume());
+
+	// What a combinator hands back for one awaitable: void becomes monostate, a reference becomes a reference_wrapper
+	template <Awaitable T>
+	using StoredResult = std::conditional_t<std::is_void_v<AwaitResult<T>>,
+		std::monostate,
+		std::conditional_t<std::is_lvalue_reference_v<AwaitResult<T>>,
+			std::reference_wrapper<std::remove_reference_t<AwaitResult<T>>>,
+			std::remove_cvref_t<AwaitResult<T>>>>;
+
+	template <typename T> struct ResultSlot
+	{
+		std::optional<T> Value;
+		std::exception_ptr Exception;
+
+		[[nodiscard]] T Take()
+		{
+			if (Exception)
+			{
+				std::rethrow_exception(Exception);
+			}
+			return std::move(*Value);
+		}
+	};
+
+	/**
+	 * Counts the arrivals a combinator waits for. Whoever makes the last arrival continues with the combinator; the
+	 * combinator itself arrives once it has started every element, so it is never resumed while still starting them.
+	 */
+	struct ArrivalCounter
+	{
+		explicit ArrivalCounter(const std::size_t InCount) : m_Remaining(InCount) {}
+		virtual ~ArrivalCounter() = default;
+		ArrivalCounter(const ArrivalCounter&) = delete;
+		ArrivalCounter(ArrivalCounter&&) = delete;
+		ArrivalCounter& operator=(const ArrivalCounter&) = delete;
+		ArrivalCounter& operator=(ArrivalCounter&&) = delete;
+
+		// Called by the element at InIndex once it has finished; returns what to run next
+		[[nodiscard]] virtual std::coroutine_handle<> Arrive(std::size_t InIndex) noexcept = 0;
+
+		[[nodiscard]] std::coroutine_handle<> CountDown() noexcept
+		{
+			if (m_Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				return m_Continuation;
+			}
+			return std::noop_coroutine();
+		}
+
+		std::atomic<std::size_t> m_Remaining;
+		std::coroutine_handle<> m_Continuation;
+	};
+
+	/**
+	 * Awaits one element on behalf of a combinator. When the element finishes the driver frees its own frame and then
+	 * reports to the combinator, so the combinator never has to wait on, or destroy, a driver that is still running.
+	 */
+	struct ElementDriver
+	{
+		struct promise_type : PooledFrame
+		{
+			std::shared_ptr<ArrivalCounter> m_Counter;
+			std::size_t m_Index{ 0 };
+
+			[[nodiscard]] ElementDriver get_return_object()
+			{
+				return ElementDriver{ std::coroutine_handle<promise_type>::from_promise(*this) };
+			}
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			[[nodiscard]] auto final_suspend() noexcept
+			{
+				struct FinalArrival
+				{
+					[[nodiscard]] bool await_ready() const noexcept { return false; }
+					[[nodiscard]] std::coroutine_handle<> await_suspend(
+						const std::coroutine_handle<promise_type> InHandle) const noexcept
+					{
+						const std::shared_ptr<ArrivalCounter> Counter = std::move(InHandle.promise().m_Counter);
+						const std::size_t Index = InHandle.promise().m_Index;
+						InHandle.destroy();
+						return Counter->Arrive(Index);
+					}
+					void await_resume() const noexcept {}
+				};
+				return FinalArrival{};
+			}
+			void return_void() noexcept {}
+			// The driver body catches everything into its result slot
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+
+		explicit ElementDriver(const std::coroutine_handle<promise_type> InHandle) : m_Handle{ InHandle } {}
+		~ElementDriver()
+		{
+			if (m_Handle)
+			{
+				m_Handle.destroy();
+			}
+		}
+		ElementDriver(const ElementDriver&) = delete;
+		ElementDriver& operator=(const ElementDriver&) = delete;
+		ElementDriver(ElementDriver&& Other) noexcept : m_Handle{ std::exchange(Other.m_Handle, {}) } {}
+		ElementDriver& operator=(ElementDriver&&) = delete;
+
+		// From here on the driver owns its frame
+		void Start(std::shared_ptr<ArrivalCounter> InCounter, const std::size_t InIndex)
+		{
+			m_Handle.promise().m_Counter = std::move(InCounter);
+			m_Handle.promise().m_Index = InIndex;
+			std::exchange(m_Handle, {}).resume();
+		}
+
+		std::coroutine_handle<promise_type> m_Handle;
+	};
+
+	template <Awaitable T> ElementDriver DriveElement(T& InAwaitable, ResultSlot<StoredResult<T>>& OutSlot)
+	{
+		try
+		{
+			if constexpr (std::is_void_v<AwaitResult<T>>)
+			{
+				co_await InAwaitable;
+				OutSlot.Value.emplace();
+			}
+			else
+			{
+				OutSlot.Value.emplace(co_await InAwaitable);
+			}
+		}
+		catch (...)
+		{
+			OutSlot.Exception = std::current_exception();
+		}
+	}
+
+	/**
+	 * Starts every driver, then suspends the combinator until its counter lets it go on. Holds the counter by
+	 * reference: the combinator keeps it, and GCC 12 can destroy an awaiter temporary twice.
+	 */
+	struct StartAwaiter
+	{
+		const std::shared_ptr<ArrivalCounter>& Counter;
+		std::span<ElementDriver> Drivers;
+
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+		[[nodiscard]] std::coroutine_handle<> await_suspend(const std::coroutine_handle<> InAwaiter) const
+		{
+			Counter->m_Continuation = InAwaiter;
+			for (std::size_t Index = 0; Index < Drivers.size(); ++Index)
+			{
+				Drivers[Index].Start(Counter, Index);
+			}
+			return Counter->CountDown();
+		}
+		void await_resume() const noexcept {}
+	};
+
+	struct WhenAllCounter final : ArrivalCounter
+	{
+		explicit WhenAllCounter(const std::size_t InCount) : ArrivalCounter(InCount + 1) {}
+
+		[[nodiscard]] std::coroutine_handle<> Arrive(std::size_t) noexcept override { return CountDown(); }
+	};
+
+	/**
+	 * The first arrival wins and releases the combinator. The combinator then cancels the losers it can cancel and
+	 * waits on m_Cancelled until each of them has finished, so none is still touching its awaitable afterwards.
+	 */
+	template <typename... Results> struct WhenAnyState final : ArrivalCounter
+	{
+		explicit WhenAnyState(const std::array<bool, sizeof...(Results)>& InCancellable)
+			: ArrivalCounter(2),
+			  m_Cancellable(InCancellable)
+		{
+			for (const bool IsCancellable : InCancellable)
+			{
+				m_Cancelled.m_Remaining.fetch_add(IsCancellable ? 1 : 0, std::memory_order_relaxed);
+			}
+		}
+
+		[[nodiscard]] std::coroutine_handle<> Arrive(const std::size_t InIndex) noexcept override
+		{
+			std::coroutine_handle<> Next = std::noop_coroutine();
+			if (m_Cancellable[InIndex])
+			{
+				Next = m_Cancelled.CountDown();
+			}
+			if (!m_Decided.exchange(true, std::memory_order_acq_rel))
+			{
+				m_Winner = InIndex;
+				Next = CountDown();
+			}
+			return Next;
+		}
+
+		// Second phase: counts the cancellable elements, plus one for the combinator
+		struct CancelledCounter final : ArrivalCounter
+		{
+			CancelledCounter() : ArrivalCounter(1) {}
+			[[nodiscard]] std::coroutine_handle<> Arrive(std::size_t) noexcept override { return CountDown(); }
+		};
+
+		// Suspends the combinator until every cancellable element has finished
+		struct DrainAwaiter
+		{
+			ArrivalCounter& Counter;
+
+			[[nodiscard]] bool await_ready() const noexcept { return false; }
+			[[nodiscard]] std::coroutine_handle<> await_suspend(const std::coroutine_handle<> InAwaiter) const noexcept
+			{
+				Counter.m_Continuation = InAwaiter;
+				return Counter.CountDown();
+			}
+			void await_resume() const noexcept {}
+		};
+
+		std::tuple<ResultSlot<Results>...> m_Slots;
+		const std::array<bool, sizeof...(Results)> m_Cancellable;
+		CancelledCounter m_Cancelled;
+		std::atomic<bool> m_Decided{ false };
+		std::size_t m_Winner{ 0 };
+	};
+
+	template <typename T> void CancelIfPossible(T& InAwaitable)
+	{
+		if constexpr (Cancellable<T>)
+		{
+			InAwaitable.Cancel();
+		}
+	}
+} // namespace TaskDetail
+
+/**
+ * Await every awaitable at once and return all of their results, in order. Each one is started before any is waited
+ * on, so requests sent through SendRequest go out in one burst. If any of them threw, the first such exception by
+ * position is rethrown once all have finished. The awaitables must outlive the returned task.
+ */
+template <TaskDetail::Awaitable... Awaitables>
+	requires(sizeof...(Awaitables) > 0)
+[[nodiscard]] Task<std::tuple<TaskDetail::StoredResult<Awaitables>...>> WhenAll(Awaitables&... InAwaitables)
+{
+	std::tuple<TaskDetail::ResultSlot<TaskDetail::StoredResult<Awaitables>>...> Slots;
+	std::array<TaskDetail::ElementDriver, sizeof...(Awaitables)> Drivers
+		= [&]<std::size_t... Index>(std::index_sequence<Index...>)
+	{
+		return std::array{ TaskDetail::DriveElement(InAwaitables, std::get<Index>(Slots))... };
+	}(std::index_sequence_for<Awaitables...>{});
+
+	const std::shared_ptr<TaskDetail::ArrivalCounter> Counter
+		= std::make_shared<TaskDetail::WhenAllCounter>(sizeof...(Awaitables));
+	co_await TaskDetail::StartAwaiter{ Counter, Drivers };
+
+	co_return std::apply(
+		[](auto&... InSlots) { return std::tuple<TaskDetail::StoredResult<Awaitables>...>{ InSlots.Take()... }; },
+		Slots);
+}
+
+// Await a run-time number of awaitables of one type; otherwise the same as the variadic WhenAll
+template <TaskDetail::Awaitable Awaitable>
+[[nodiscard]] Task<std::vector<TaskDetail::StoredResult<Awaitable>>> WhenAll(std::vector<Awaitable>& InAwaitables)
+{
+	std::vector<TaskDetail::ResultSlot<TaskDetail::StoredResult<Awaitable>>> Slots(InAwaitables.size());
+	std::vector<TaskDetail::ElementDriver> Drivers;
+	Drivers.reserve(InAwaitables.size());
+	for (std::size_t Index = 0; Index < InAwaitables.size(); ++Index)
+	{
+		Drivers.push_back(TaskDetail::DriveElement(InAwaitables[Index], Slots[Index]));
+	}
+
+	const std::shared_ptr<TaskDetail::ArrivalCounter> Counter
+		= std::make_shared<TaskDetail::WhenAllCounter>(InAwaitables.size());
+	co_await TaskDetail::StartAwaiter{ Counter, Drivers };
+
+	std::vector<TaskDetail::StoredResult<Awaitable>> Results;
+	Results.reserve(Slots.size());
+	for (auto& Slot : Slots)
+	{
+		Results.push_back(Slot.Take());
+	}
+	co_return Results;
+}
+
+/**
+ * Await the first of several awaitables to finish and return its result; the variant's index says which one it was.
+ * The others are cancelled if they support it (ResponseTask, TimerWheel::SleepAwaiter) and have finished by the time
+ * this returns. Any other loser, such as a plain Task, runs on to completion and its result is dropped, so it must be
+ * kept alive until then. An exception from the winner is rethrown.
+ */
+template <TaskDetail::Awaitable... Awaitables>
+	requires(sizeof...(Awaitables) > 0)
+[[nodiscard]] Task<std::variant<TaskDetail::StoredResult<Awaitables>...>> WhenAny(Awaitables&... InAwaitables)
+{
+	using ResultVariant = std::variant<TaskDetail::StoredResult<Awaitables>...>;
+	using State = TaskDetail::WhenAnyState<TaskDetail::StoredResult<Awaitables>...>;
+
+	const std::shared_ptr<State> Shared = std::make_shared<State>(
+		std::array<bool, sizeof...(Awaitables)>{ TaskDetail::Cancellable<Awaitables>... });
+	std::array<TaskDetail::ElementDriver, sizeof...(Awaitables)> Drivers
+		= [&]<std::size_t... Index>(std::index_sequence<Index...>)
+	{
+		return std::array{ TaskDetail::DriveElement(InAwaitables, std::get<Index>(Shared->m_Slots))... };
+	}(std::index_sequence_for<Awaitables...>{});
+
+	const std::shared_ptr<TaskDetail::ArrivalCounter> Counter = Shared;
+	co_await TaskDetail::StartAwaiter{ Counter, Drivers };
+
+	const std::size_t Winner = Shared->m_Winner;
+	[&]<std::size_t... Index>(std::index_sequence<Index...>)
+	{
+		((Index != Winner ? TaskDetail::CancelIfPossible(InAwaitables) : void()), ...);
+	}(std::index_sequence_for<Awaitables...>{});
+	co_await typename State::DrainAwaiter{ Shared->m_Cancelled };
+
+	std::optional<ResultVariant> Result;
+	[&]<std::size_t... Index>(std::index_sequence<Index...>)
+	{
+		((Index == Winner ? (void)Result.emplace(std::in_place_index<Index>, std::get<Index>(Shared->m_Slots).Take())
+						  : void()),
+			...);
+	}(std::index_sequence_for<Awaitables...>{});
+	co_return std::move(*Result);
+}
+
+/**
+ * Await InAwaitable for at most InTimeout. Returns its result, or nullopt if the time ran out first, in which case the
+ * awaitable is cancelled like a WhenAny loser.
+ */
+template <TaskDetail::Awaitable Awaitable>
+[[nodiscard]] Task<std::optional<TaskDetail::StoredResult<Awaitable>>> WithTimeout(Awaitable& InAwaitable,
+	const std::chrono::milliseconds InTimeout,
+	TimerWheel& InTimers = TimerWheel::Shared())
+{
+	TimerWheel::SleepAwaiter Deadline = InTimers.Sleep(InTimeout);
+	auto Winner = co_await WhenAny(InAwaitable, Deadline);
+	if (Winner.index() == 0)
+	{
+		co_return std::move(std::get<0>(Winner));
+	}
+	co_return std::nullopt;
+}
+
+MCP_NAMESPACE_END
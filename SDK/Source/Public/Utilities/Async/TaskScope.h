@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "CoreSDK/Common/Macros.h"
+#include "CoreSDK/Common/RuntimeError.h"
+#include "Utilities/Async/FrameAllocator.h"
+#include "Utilities/Async/Task.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Owner of coroutines that run without an awaiting caller. Spawn starts a task at once, and Join blocks until every
+ * task spawned so far has finished, so the owner can tear down whatever those tasks use without polling for them.
+ */
+class TaskScope
+{
+public:
+	TaskScope() = default;
+	// Joins any task still running
+	~TaskScope() noexcept { Join(); }
+	TaskScope(const TaskScope&) = delete;
+	TaskScope(TaskScope&&) = delete;
+	TaskScope& operator=(const TaskScope&) = delete;
+	TaskScope& operator=(TaskScope&&) = delete;
+
+	// Start InTask on the calling thread. Its result is dropped and anything it throws is reported.
+	template <typename T> void Spawn(Task<T> InTask)
+	{
+		{
+			std::scoped_lock Lock(m_Mutex);
+			++m_Active;
+		}
+		Run(std::move(InTask), *this);
+	}
+
+	// Block until every spawned task has finished. Must not be called from one of them.
+	void Join()
+	{
+		std::unique_lock Lock(m_Mutex);
+		m_Idle.wait(Lock, [this] { return m_Active == 0; });
+	}
+
+	[[nodiscard]] std::size_t GetActiveCount() const
+	{
+		std::scoped_lock Lock(m_Mutex);
+		return m_Active;
+	}
+
+private:
+	struct Detached
+	{
+		struct promise_type : PooledFrame
+		{
+			Detached get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	template <typename T> static Detached Run(Task<T> InTask, TaskScope& InScope)
+	{
+		{
+			// The task's frame is released before the scope hears of it, so nothing it owns outlives Join
+			const Task<T> Owned = std::move(InTask);
+			try
+			{
+				co_await Owned;
+			}
+			catch (const std::exception& Except)
+			{
+				HandleRuntimeError("Unhandled exception in spawned task: " + std::string(Except.what()));
+			}
+			catch (...)
+			{
+				HandleRuntimeError("Unknown exception in spawned task");
+			}
+		}
+
+		// Notified under the lock: once Join sees zero the scope may be gone
+		std::scoped_lock Lock(InScope.m_Mutex);
+		--InScope.m_Active;
+		InScope.m_Idle.notify_all();
+	}
+
+	mutable std::mutex m_Mutex;
+	std::condition_variable m_Idle;
+	std::size_t m_Active{ 0 };
+};
+
+MCP_NAMESPACE_END
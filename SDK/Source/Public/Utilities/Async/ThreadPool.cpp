@@ -0,0 +1,246 @@
+#include "Utilities/Async/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+MCP_NAMESPACE_BEGIN
+
+namespace
+{
+	// The pool and queue index of the worker running on this thread, so its posts stay local
+	thread_local const ThreadPool* t_CurrentPool{ nullptr };
+	thread_local std::size_t t_WorkerIndex{ 0 };
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t InThreadCount)
+{
+	if (InThreadCount == 0)
+	{
+		InThreadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+	}
+
+	// Every queue exists before the first worker can try to steal from it
+	m_WorkerQueues.reserve(InThreadCount);
+	for (std::size_t Index = 0; Index < InThreadCount; ++Index)
+	{
+		m_WorkerQueues.emplace_back(std::make_unique<WorkerQueue>());
+	}
+
+	m_Workers.reserve(InThreadCount);
+	for (std::size_t Index = 0; Index < InThreadCount; ++Index)
+	{
+		m_Workers.emplace_back([this, Index](const std::stop_token& InStopToken) { WorkerLoop(Index, InStopToken); });
+	}
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+	for (std::jthread& Worker : m_Workers)
+	{
+		Worker.request_stop();
+	}
+	m_HasWork.notify_all();
+	m_Workers.clear();
+}
+
+ThreadPool& ThreadPool::Shared()
+{
+	static ThreadPool Instance;
+	return Instance;
+}
+
+bool ThreadPool::IsWorkerThread() const { return t_CurrentPool == this; }
+
+void ThreadPool::Post(Job InJob)
+{
+	if (t_CurrentPool == this)
+	{
+		WorkerQueue& Local = *m_WorkerQueues[t_WorkerIndex];
+		{
+			// Counted under the queue's lock, so no thief can take the job before it is counted
+			std::lock_guard Lock(Local.Mutex);
+			Local.Jobs.emplace_back(std::move(InJob));
+			++m_PendingJobs;
+		}
+		WakeWorker();
+		return;
+	}
+
+	{
+		std::lock_guard Lock(m_Mutex);
+		m_Queue.emplace_back(std::move(InJob));
+		++m_PendingJobs;
+	}
+	m_HasWork.notify_one();
+}
+
+void ThreadPool::WakeWorker()
+{
+	// Pairs with the sleeping count a worker raises before it checks for jobs: either it sees the job, or this sees
+	// it and its wait cannot begin until the lock below is released
+	if (m_SleepingWorkers.load() == 0)
+	{
+		return;
+	}
+	{
+		std::lock_guard Lock(m_Mutex);
+	}
+	m_HasWork.notify_one();
+}
+
+void ThreadPool::ParallelFor(const std::size_t InCount, const std::function<void(std::size_t)>& InBody)
+{
+	if (InCount == 0)
+	{
+		return;
+	}
+	if (InCount == 1)
+	{
+		InBody(0);
+		return;
+	}
+
+	// Helpers that start after every index is claimed only touch this state, never InBody
+	struct SharedState
+	{
+		const std::function<void(std::size_t)>* Body{ nullptr };
+		std::size_t Count{ 0 };
+		std::atomic<std::size_t> Next{ 0 };
+		std::mutex Mutex;
+		std::condition_variable Finished;
+		std::size_t Completed{ 0 };
+		std::exception_ptr Error;
+	};
+
+	auto State = std::make_shared<SharedState>();
+	State->Body = &InBody;
+	State->Count = InCount;
+
+	const auto RunIndices = [](const std::shared_ptr<SharedState>& InState)
+	{
+		for (std::size_t Index = InState->Next++; Index < InState->Count; Index = InState->Next++)
+		{
+			std::exception_ptr Error;
+			try
+			{
+				(*InState->Body)(Index);
+			}
+			catch (...)
+			{
+				Error = std::current_exception();
+			}
+
+			std::lock_guard Lock(InState->Mutex);
+			if (Error && !InState->Error)
+			{
+				InState->Error = Error;
+			}
+			if (++InState->Completed == InState->Count)
+			{
+				InState->Finished.notify_all();
+			}
+		}
+	};
+
+	const std::size_t Helpers = std::min(InCount - 1, m_Workers.size());
+	for (std::size_t Index = 0; Index < Helpers; ++Index)
+	{
+		Post([State, RunIndices] { RunIndices(State); });
+	}
+	RunIndices(State);
+
+	std::unique_lock Lock(State->Mutex);
+	State->Finished.wait(Lock, [&State] { return State->Completed == State->Count; });
+	if (State->Error)
+	{
+		std::rethrow_exception(State->Error);
+	}
+}
+
+bool ThreadPool::TakeJob(const std::size_t InIndex, Job& OutJob)
+{
+	const auto Claim = [this, &OutJob](std::deque<Job>& InJobs, const bool InNewest)
+	{
+		if (InJobs.empty())
+		{
+			return false;
+		}
+		if (InNewest)
+		{
+			OutJob = std::move(InJobs.back());
+			InJobs.pop_back();
+		}
+		else
+		{
+			OutJob = std::move(InJobs.front());
+			InJobs.pop_front();
+		}
+		--m_PendingJobs;
+		return true;
+	};
+
+	{
+		WorkerQueue& Local = *m_WorkerQueues[InIndex];
+		std::lock_guard Lock(Local.Mutex);
+		if (Claim(Local.Jobs, true))
+		{
+			return true;
+		}
+	}
+	{
+		std::lock_guard Lock(m_Mutex);
+		if (Claim(m_Queue, false))
+		{
+			return true;
+		}
+	}
+	for (std::size_t Offset = 1; Offset < m_WorkerQueues.size(); ++Offset)
+	{
+		WorkerQueue& Victim = *m_WorkerQueues[(InIndex + Offset) % m_WorkerQueues.size()];
+		std::lock_guard Lock(Victim.Mutex);
+		if (Claim(Victim.Jobs, false))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::WorkerLoop(const std::size_t InIndex, const std::stop_token& InStopToken)
+{
+	t_CurrentPool = this;
+	t_WorkerIndex = InIndex;
+
+	while (true)
+	{
+		Job NextJob;
+		if (!TakeJob(InIndex, NextJob))
+		{
+			// A stopping pool drains its queues first. Jobs the other workers post from here on go to their own
+			// queues, which they drain before they stop in turn.
+			if (InStopToken.stop_requested())
+			{
+				return;
+			}
+
+			std::unique_lock Lock(m_Mutex);
+			++m_SleepingWorkers;
+			m_HasWork.wait(Lock, InStopToken, [this] { return m_PendingJobs.load() > 0; });
+			--m_SleepingWorkers;
+			continue;
+		}
+
+		try
+		{
+			NextJob();
+		}
+		catch (...)
+		{
+			// A failing job must not take the worker down with it
+		}
+	}
+}
+
+MCP_NAMESPACE_END
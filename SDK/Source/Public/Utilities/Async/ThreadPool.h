@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Fixed set of worker threads that share out jobs by work stealing.
+ * Each worker keeps its own queue: jobs posted from a worker go to that worker's queue and are run newest first while
+ * they are still cache-warm, and an idle worker steals the oldest job from a busy one. Jobs posted from other threads
+ * go to a shared queue that every worker drains. Used to spread independent message handlers over the available cores.
+ */
+class ThreadPool
+{
+public:
+	using Job = std::function<void()>;
+
+	// Zero selects one thread per hardware thread
+	static constexpr std::size_t DEFAULT_THREAD_COUNT{ 0 };
+
+	explicit ThreadPool(std::size_t InThreadCount = DEFAULT_THREAD_COUNT);
+	// Runs every job still queued, including those they post in turn, before the workers stop
+	~ThreadPool() noexcept;
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	ThreadPool& operator=(ThreadPool&&) = delete;
+
+	// Process-wide pool used for message dispatch
+	[[nodiscard]] static ThreadPool& Shared();
+
+	void Post(Job InJob);
+
+	// Resumes the awaiting coroutine on one of the workers
+	struct ScheduleAwaiter
+	{
+		ThreadPool& Pool;
+
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+		void await_suspend(const std::coroutine_handle<> InAwaiter) const
+		{
+			Pool.Post([InAwaiter] { InAwaiter.resume(); });
+		}
+		void await_resume() const noexcept {}
+	};
+
+	/**
+	 * Move the calling coroutine onto the pool: `co_await Pool.Schedule();` returns on a worker thread.
+	 * From a worker the coroutine is queued on that same worker, where an idle worker can steal it.
+	 */
+	[[nodiscard]] ScheduleAwaiter Schedule() { return ScheduleAwaiter{ *this }; }
+
+	/**
+	 * Run InBody for every index in [0, InCount) and return once all calls have finished.
+	 * The calling thread takes part, so this makes progress even when every worker is busy, including when called
+	 * from a worker.
+	 */
+	void ParallelFor(std::size_t InCount, const std::function<void(std::size_t)>& InBody);
+
+	[[nodiscard]] std::size_t GetThreadCount() const { return m_Workers.size(); }
+
+	// Whether the calling thread is one of this pool's workers
+	[[nodiscard]] bool IsWorkerThread() const;
+
+private:
+	struct WorkerQueue
+	{
+		std::mutex Mutex;
+		std::deque<Job> Jobs;
+	};
+
+	void WorkerLoop(std::size_t InIndex, const std::stop_token& InStopToken);
+	// Take the next job for worker InIndex: its own newest, then the shared queue, then another worker's oldest
+	[[nodiscard]] bool TakeJob(std::size_t InIndex, Job& OutJob);
+	// Wake a sleeping worker, if there is one, after a job was queued
+	void WakeWorker();
+
+	// Guards the shared queue and the sleep of idle workers
+	std::mutex m_Mutex;
+	std::condition_variable_any m_HasWork;
+	std::deque<Job> m_Queue;
+	std::vector<std::unique_ptr<WorkerQueue>> m_WorkerQueues;
+	// Jobs queued anywhere and not yet taken; idle workers sleep while it is zero
+	std::atomic<std::size_t> m_PendingJobs{ 0 };
+	std::atomic<std::size_t> m_SleepingWorkers{ 0 };
+	std::vector<std::jthread> m_Workers;
+};
+
+MCP_NAMESPACE_END
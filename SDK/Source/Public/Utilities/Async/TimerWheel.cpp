@@ -0,0 +1,219 @@
+#include "Utilities/Async/TimerWheel.h"
+
+#include <algorithm>
+
+MCP_NAMESPACE_BEGIN
+
+TimerWheel::TimerWheel(const std::chrono::milliseconds InTick)
+	: m_Tick(std::max(InTick, std::chrono::milliseconds{ 1 })),
+	  m_Start(std::chrono::steady_clock::now()),
+	  m_Driver([this](const std::stop_token& InStopToken) { DriverLoop(InStopToken); })
+{}
+
+TimerWheel::~TimerWheel() noexcept
+{
+	m_Driver.request_stop();
+	if (m_Driver.joinable())
+	{
+		m_Driver.join();
+	}
+}
+
+TimerWheel& TimerWheel::Shared()
+{
+	static TimerWheel Instance;
+	return Instance;
+}
+
+TimerWheel::TimerID TimerWheel::Schedule(const std::chrono::milliseconds InDelay, Callback InCallback)
+{
+	const uint64_t DelayTicks = (std::max(InDelay.count(), std::chrono::milliseconds::rep{ 0 }) + m_Tick.count() - 1)
+		/ m_Tick.count();
+
+	TimerID NewTimerID;
+	{
+		std::scoped_lock Lock(m_Mutex);
+
+		// An idle wheel has nothing to cascade, so it can skip straight to the present instead of replaying each tick
+		if (m_Timers.empty())
+		{
+			m_CurrentTick = std::max(m_CurrentTick, ElapsedTicks());
+		}
+
+		NewTimerID = m_NextTimerID++;
+		Timer& NewTimer = m_Timers[NewTimerID];
+		// The current tick is partly over, so one more keeps the timer from firing early
+		NewTimer.ExpiryTick = std::max(ElapsedTicks() + DelayTicks + 1, m_CurrentTick + 1);
+		NewTimer.OnExpired = std::move(InCallback);
+		Place(NewTimerID, NewTimer);
+		++m_Generation;
+	}
+	m_Changed.notify_one();
+	return NewTimerID;
+}
+
+bool TimerWheel::Cancel(const TimerID InTimerID)
+{
+	std::scoped_lock Lock(m_Mutex);
+
+	const auto Iter = m_Timers.find(InTimerID);
+	if (Iter == m_Timers.end())
+	{
+		return false;
+	}
+	Iter->second.Owner->erase(Iter->second.Position);
+	m_Timers.erase(Iter);
+	return true;
+}
+
+std::size_t TimerWheel::GetPendingCount() const
+{
+	std::scoped_lock Lock(m_Mutex);
+	return m_Timers.size();
+}
+
+uint64_t TimerWheel::ElapsedTicks() const
+{
+	return static_cast<uint64_t>((std::chrono::steady_clock::now() - m_Start) / m_Tick);
+}
+
+uint64_t TimerWheel::NextEventTick() const
+{
+	// Every bucket at or before the current one has already been drained, and each level only holds timers within the
+	// current bucket of the level above, so the first occupied slot found scanning from the finest level is the
+	// earliest
+	for (std::size_t Level = 0; Level < LEVEL_COUNT; ++Level)
+	{
+		const std::size_t Shift = SLOT_BITS * Level;
+		const uint64_t Current = m_CurrentTick >> Shift;
+		for (uint64_t Index = (Current & (SLOTS_PER_LEVEL - 1)) + 1; Index < SLOTS_PER_LEVEL; ++Index)
+		{
+			if (!m_Levels[Level][Index].empty())
+			{
+				return ((Current & ~uint64_t{ SLOTS_PER_LEVEL - 1 }) | Index) << Shift;
+			}
+		}
+	}
+
+	// Only the overflow list is left, which is redistributed when the top level wraps
+	constexpr std::size_t Span = SLOT_BITS * LEVEL_COUNT;
+	return ((m_CurrentTick >> Span) + 1) << Span;
+}
+
+void TimerWheel::Place(const TimerID InTimerID, Timer& InTimer)
+{
+	if ((InTimer.ExpiryTick >> (SLOT_BITS * LEVEL_COUNT)) != (m_CurrentTick >> (SLOT_BITS * LEVEL_COUNT)))
+	{
+		// Beyond the top level's current revolution, where its slot index would wrap around
+		InTimer.Owner = &m_Overflow;
+		InTimer.Position = m_Overflow.insert(m_Overflow.end(), InTimerID);
+		return;
+	}
+
+	std::size_t Level = 0;
+	std::size_t Index = m_CurrentTick & (SLOTS_PER_LEVEL - 1);
+
+	if (InTimer.ExpiryTick > m_CurrentTick)
+	{
+		// The finest level whose enclosing bucket the expiry shares with the current tick; the top level takes the rest
+		while (Level + 1 < LEVEL_COUNT
+			&& (InTimer.ExpiryTick >> (SLOT_BITS * (Level + 1))) != (m_CurrentTick >> (SLOT_BITS * (Level + 1))))
+		{
+			++Level;
+		}
+		Index = (InTimer.ExpiryTick >> (SLOT_BITS * Level)) & (SLOTS_PER_LEVEL - 1);
+	}
+
+	Slot& Target = m_Levels[Level][Index];
+	InTimer.Owner = &Target;
+	InTimer.Position = Target.insert(Target.end(), InTimerID);
+}
+
+void TimerWheel::Advance(std::vector<Callback>& OutExpired)
+{
+	++m_CurrentTick;
+
+	// Entering a new bucket of a coarser level redistributes that bucket, coarsest first, so timers can fall through
+	// several levels on the same tick
+	std::size_t CascadeLevels = 0;
+	while (CascadeLevels + 1 < LEVEL_COUNT
+		&& (m_CurrentTick & ((uint64_t{ 1 } << (SLOT_BITS * (CascadeLevels + 1))) - 1)) == 0)
+	{
+		++CascadeLevels;
+	}
+	if ((m_CurrentTick & ((uint64_t{ 1 } << (SLOT_BITS * LEVEL_COUNT)) - 1)) == 0)
+	{
+		// The top level wrapped; whatever is still out of reach goes straight back into the overflow list
+		Slot Moving;
+		Moving.splice(Moving.end(), m_Overflow);
+		for (const TimerID MovingTimerID : Moving)
+		{
+			Place(MovingTimerID, m_Timers.at(MovingTimerID));
+		}
+	}
+	for (std::size_t Level = CascadeLevels; Level > 0; --Level)
+	{
+		Slot Moving;
+		Moving.splice(Moving.end(), m_Levels[Level][(m_CurrentTick >> (SLOT_BITS * Level)) & (SLOTS_PER_LEVEL - 1)]);
+		for (const TimerID MovingTimerID : Moving)
+		{
+			Place(MovingTimerID, m_Timers.at(MovingTimerID));
+		}
+	}
+
+	Slot& Due = m_Levels[0][m_CurrentTick & (SLOTS_PER_LEVEL - 1)];
+	for (const TimerID DueTimerID : Due)
+	{
+		const auto Iter = m_Timers.find(DueTimerID);
+		OutExpired.emplace_back(std::move(Iter->second.OnExpired));
+		m_Timers.erase(Iter);
+	}
+	Due.clear();
+}
+
+void TimerWheel::DriverLoop(const std::stop_token& InStopToken)
+{
+	while (!InStopToken.stop_requested())
+	{
+		std::vector<Callback> Expired;
+		{
+			std::unique_lock Lock(m_Mutex);
+			if (!m_Changed.wait(Lock, InStopToken, [this] { return !m_Timers.empty(); }))
+			{
+				return;
+			}
+
+			// Nothing falls due or cascades before the next event, so the ticks up to it are skipped, not replayed
+			for (const uint64_t Now = ElapsedTicks(); m_CurrentTick < Now && !m_Timers.empty();)
+			{
+				m_CurrentTick = std::max(m_CurrentTick, std::min(Now, NextEventTick()) - 1);
+				Advance(Expired);
+			}
+
+			if (Expired.empty() && !m_Timers.empty())
+			{
+				// Sleep until the next event rather than ticking, unless a new timer might come due sooner
+				const auto NextEvent = m_Start + m_Tick * NextEventTick();
+				m_Changed.wait_until(Lock,
+					InStopToken,
+					NextEvent,
+					[this, Generation = m_Generation] { return m_Generation != Generation; });
+				continue;
+			}
+		}
+
+		for (Callback& OnExpired : Expired)
+		{
+			try
+			{
+				OnExpired();
+			}
+			catch (...)
+			{
+				// A failing callback must not stop the wheel
+			}
+		}
+	}
+}
+
+MCP_NAMESPACE_END
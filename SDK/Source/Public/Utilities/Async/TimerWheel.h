@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/Async/ThreadPool.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Hierarchical timing wheel for large numbers of mostly-cancelled timeouts.
+ * Scheduling and cancelling are O(1); a timer far in the future sits in a coarse level and is moved down a level each
+ * time the finer wheel below it wraps, and one beyond the reach of the top level waits in an overflow list until the
+ * top level wraps. A dedicated thread sleeps until the next timer falls due or has to move down a level, then runs
+ * expired callbacks, so callbacks should hand longer work off elsewhere.
+ */
+class TimerWheel
+{
+public:
+	using TimerID = uint64_t;
+	using Callback = std::function<void()>;
+
+	static constexpr std::chrono::milliseconds DEFAULT_TICK{ 10 };
+	// Never handed out, so it can mark "no timer"
+	static constexpr TimerID INVALID_TIMER{ 0 };
+
+	explicit TimerWheel(std::chrono::milliseconds InTick = DEFAULT_TICK);
+	// Pending timers are dropped without running. Must not be destroyed from one of its own callbacks.
+	~TimerWheel() noexcept;
+	TimerWheel(const TimerWheel&) = delete;
+	TimerWheel(TimerWheel&&) = delete;
+	TimerWheel& operator=(const TimerWheel&) = delete;
+	TimerWheel& operator=(TimerWheel&&) = delete;
+
+	// Process-wide wheel for timeouts that are not tied to a connection
+	[[nodiscard]] static TimerWheel& Shared();
+
+	// Run InCallback once InDelay has passed, rounded up to the tick
+	TimerID Schedule(std::chrono::milliseconds InDelay, Callback InCallback);
+
+	// Returns false if the timer already fired or was cancelled
+	bool Cancel(TimerID InTimerID);
+
+	[[nodiscard]] std::size_t GetPendingCount() const;
+
+	// Resumes the awaiting coroutine on the shared ThreadPool once the delay has passed
+	struct SleepAwaiter
+	{
+		TimerWheel& Wheel;
+		std::chrono::milliseconds Delay;
+		TimerID ID{ INVALID_TIMER };
+		std::coroutine_handle<> Awaiter;
+
+		[[nodiscard]] bool await_ready() const noexcept { return Delay <= std::chrono::milliseconds::zero(); }
+		void await_suspend(const std::coroutine_handle<> InAwaiter)
+		{
+			Awaiter = InAwaiter;
+			ID = Wheel.Schedule(Delay, [InAwaiter] { ThreadPool::Shared().Post([InAwaiter] { InAwaiter.resume(); }); });
+		}
+		void await_resume() const noexcept {}
+
+		// Wake the sleeper now, on the calling thread. Returns false if the timer already fired or was never started.
+		bool Cancel()
+		{
+			if (!Wheel.Cancel(ID))
+			{
+				return false;
+			}
+			Awaiter.resume();
+			return true;
+		}
+	};
+
+	// `co_await Timers.Sleep(Delay);` suspends the calling coroutine for Delay, rounded up to the tick
+	[[nodiscard]] SleepAwaiter Sleep(const std::chrono::milliseconds InDelay)
+	{
+		return SleepAwaiter{ *this, InDelay, INVALID_TIMER, {} };
+	}
+
+private:
+	static constexpr std::size_t SLOT_BITS{ 6 };
+	static constexpr std::size_t SLOTS_PER_LEVEL{ std::size_t{ 1 } << SLOT_BITS };
+	static constexpr std::size_t LEVEL_COUNT{ 4 };
+
+	using Slot = std::list<TimerID>;
+
+	struct Timer
+	{
+		uint64_t ExpiryTick{ 0 };
+		Callback OnExpired;
+		Slot* Owner{ nullptr };
+		Slot::iterator Position;
+	};
+
+	[[nodiscard]] uint64_t ElapsedTicks() const;
+	// The first tick after the current one on which Advance() has any work: a slot falling due or a bucket to cascade
+	[[nodiscard]] uint64_t NextEventTick() const;
+	void Place(TimerID InTimerID, Timer& InTimer);
+	// Advance one tick, moving expired callbacks into OutExpired
+	void Advance(std::vector<Callback>& OutExpired);
+	void DriverLoop(const std::stop_token& InStopToken);
+
+	const std::chrono::milliseconds m_Tick;
+	const std::chrono::steady_clock::time_point m_Start;
+
+	mutable std::mutex m_Mutex;
+	std::condition_variable_any m_Changed;
+	std::array<std::array<Slot, SLOTS_PER_LEVEL>, LEVEL_COUNT> m_Levels;
+	// Timers due after the top level's current revolution
+	Slot m_Overflow;
+	std::unordered_map<TimerID, Timer> m_Timers;
+	uint64_t m_CurrentTick{ 0 };
+	TimerID m_NextTimerID{ INVALID_TIMER + 1 };
+	// Bumped by Schedule() so the driver recomputes how long it may sleep
+	uint64_t m_Generation{ 0 };
+
+	std::jthread m_Driver;
+};
+
+MCP_NAMESPACE_END
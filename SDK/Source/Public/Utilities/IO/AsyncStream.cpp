@@ -0,0 +1,88 @@
+#include "Utilities/IO/AsyncStream.h"
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#include <string>
+
+#include "CoreSDK/Common/RuntimeError.h"
+
+MCP_NAMESPACE_BEGIN
+
+AsyncStream::AsyncStream(const NativeHandle InHandle, IOReactor& InReactor) : m_Handle(InHandle), m_Reactor(InReactor)
+{
+#if !defined(_WIN32)
+	fcntl(m_Handle, F_SETFL, fcntl(m_Handle, F_GETFL) | O_NONBLOCK);
+#endif
+}
+
+Task<std::size_t> AsyncStream::Read(const std::span<char> OutBuffer)
+{
+#if defined(_WIN32)
+	DWORD BytesRead{ 0 };
+	if (!ReadFile(m_Handle, OutBuffer.data(), static_cast<DWORD>(OutBuffer.size()), &BytesRead, nullptr))
+	{
+		co_return 0;
+	}
+	co_return static_cast<std::size_t>(BytesRead);
+#else
+	while (true)
+	{
+		const auto Count = read(m_Handle, OutBuffer.data(), OutBuffer.size());
+		if (Count >= 0)
+		{
+			co_return static_cast<std::size_t>(Count);
+		}
+		if (errno == EINTR)
+		{
+			continue;
+		}
+		if (errno != EAGAIN && errno != EWOULDBLOCK)
+		{
+			HandleRuntimeError("Error reading async stream: " + std::to_string(errno));
+			co_return 0;
+		}
+		co_await m_Reactor.Readable(m_Handle);
+	}
+#endif
+}
+
+Task<bool> AsyncStream::Write(std::string_view InData)
+{
+	while (!InData.empty())
+	{
+#if defined(_WIN32)
+		DWORD Written{ 0 };
+		if (!WriteFile(m_Handle, InData.data(), static_cast<DWORD>(InData.size()), &Written, nullptr))
+		{
+			co_return false;
+		}
+		InData.remove_prefix(Written);
+#else
+		const auto Count = write(m_Handle, InData.data(), InData.size());
+		if (Count >= 0)
+		{
+			InData.remove_prefix(static_cast<std::size_t>(Count));
+			continue;
+		}
+		if (errno == EINTR)
+		{
+			continue;
+		}
+		if (errno != EAGAIN && errno != EWOULDBLOCK)
+		{
+			HandleRuntimeError("Error writing async stream: " + std::to_string(errno));
+			co_return false;
+		}
+		co_await m_Reactor.Writable(m_Handle);
+#endif
+	}
+	co_return true;
+}
+
+MCP_NAMESPACE_END
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/Async/Task.h"
+#include "Utilities/IO/IOReactor.h"
+#include "Utilities/IO/NativeHandle.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Awaitable reads and writes on a pipe, socket or standard stream.
+ * The handle is switched to non-blocking mode; when it is not ready the calling coroutine is parked on the reactor
+ * rather than a thread, so the number of open streams does not decide the number of threads. Where the reactor is not
+ * supported the calls block the coroutine's thread instead. One read and one write may be in flight at a time.
+ */
+class AsyncStream
+{
+public:
+	/**
+	 * @param InHandle The handle to read and write. Ownership stays with the caller, who must not close it while a
+	 * read or write is in flight.
+	 * @param InReactor Reactor to wait for readiness on
+	 */
+	explicit AsyncStream(NativeHandle InHandle, IOReactor& InReactor = IOReactor::Shared());
+
+	/**
+	 * Read whatever is available, waiting until there is at least one byte.
+	 * @return The number of bytes read; zero once the peer has closed its end or the handle failed
+	 */
+	[[nodiscard]] Task<std::size_t> Read(std::span<char> OutBuffer);
+
+	/**
+	 * Write all of InData, waiting for room as often as needed.
+	 * @return False if the handle failed before everything was written
+	 */
+	[[nodiscard]] Task<bool> Write(std::string_view InData);
+
+	[[nodiscard]] NativeHandle GetHandle() const { return m_Handle; }
+
+private:
+	NativeHandle m_Handle;
+	IOReactor& m_Reactor;
+};
+
+MCP_NAMESPACE_END
@@ -0,0 +1,227 @@
+#include "Utilities/IO/CoalescingWriter.h"
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <cerrno>
+	#include <climits>
+	#include <sys/uio.h>
+	#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+#include "CoreSDK/Common/RuntimeError.h"
+
+MCP_NAMESPACE_BEGIN
+
+CoalescingWriter::CoalescingWriter(const NativeHandle InHandle,
+	const std::chrono::microseconds InFlushLatency,
+	const std::size_t InMaxBatchBytes,
+	const std::string_view InDelimiter)
+	: m_Handle(InHandle),
+	  m_FlushLatency(InFlushLatency),
+	  m_MaxBatchBytes(std::max<std::size_t>(InMaxBatchBytes, 1)),
+	  m_Delimiter(InDelimiter)
+{}
+
+CoalescingWriter::~CoalescingWriter() noexcept
+{
+	try
+	{
+		Stop();
+	}
+	catch (...)
+	{
+		// Ignore errors during destruction
+	}
+}
+
+void CoalescingWriter::Start()
+{
+	{
+		std::lock_guard Lock(m_Mutex);
+		if (m_IsAccepting)
+		{
+			return;
+		}
+		m_IsAccepting = true;
+	}
+
+	m_Thread = std::jthread([this](const std::stop_token& InStopToken) { WriteLoop(InStopToken); });
+}
+
+void CoalescingWriter::Stop()
+{
+	{
+		std::lock_guard Lock(m_Mutex);
+		m_IsAccepting = false;
+	}
+
+	if (m_Thread.joinable())
+	{
+		m_Thread.request_stop();
+		m_Wake.notify_all();
+		m_Thread.join();
+	}
+}
+
+bool CoalescingWriter::Enqueue(std::string InMessage)
+{
+	{
+		std::lock_guard Lock(m_Mutex);
+		if (!m_IsAccepting)
+		{
+			return false;
+		}
+		m_PendingBytes += InMessage.size() + m_Delimiter.size();
+		m_Pending.emplace_back(std::move(InMessage));
+	}
+	m_Wake.notify_one();
+	return true;
+}
+
+std::string CoalescingWriter::AcquireBuffer()
+{
+	std::lock_guard Lock(m_Mutex);
+	if (m_SpareBuffers.empty())
+	{
+		return {};
+	}
+	std::string Buffer = std::move(m_SpareBuffers.back());
+	m_SpareBuffers.pop_back();
+	return Buffer;
+}
+
+void CoalescingWriter::Recycle(std::vector<std::string>& InBatch)
+{
+	std::lock_guard Lock(m_Mutex);
+	for (std::string& Message : InBatch)
+	{
+		if (m_SpareBuffers.size() >= MAX_SPARE_BUFFERS)
+		{
+			break;
+		}
+		if (Message.capacity() <= MAX_SPARE_CAPACITY)
+		{
+			Message.clear();
+			m_SpareBuffers.emplace_back(std::move(Message));
+		}
+	}
+}
+
+void CoalescingWriter::WriteLoop(const std::stop_token& InStopToken)
+{
+	std::vector<std::string> Batch;
+	bool IsHealthy{ true };
+
+	while (true)
+	{
+		{
+			std::unique_lock Lock(m_Mutex);
+			m_Wake.wait(Lock, InStopToken, [this] { return !m_Pending.empty(); });
+
+			if (m_Pending.empty())
+			{
+				// Stop requested and nothing left to write
+				return;
+			}
+
+			if (m_FlushLatency.count() > 0 && !InStopToken.stop_requested())
+			{
+				// Give producers a short window to add to this batch
+				m_Wake.wait_for(Lock,
+					InStopToken,
+					m_FlushLatency,
+					[this] { return m_PendingBytes >= m_MaxBatchBytes; });
+			}
+
+			std::size_t BatchBytes{ 0 };
+			while (!m_Pending.empty() && (Batch.empty() || BatchBytes < m_MaxBatchBytes))
+			{
+				BatchBytes += m_Pending.front().size() + m_Delimiter.size();
+				Batch.emplace_back(std::move(m_Pending.front()));
+				m_Pending.pop_front();
+			}
+			m_PendingBytes -= BatchBytes;
+		}
+
+		if (IsHealthy && !WriteBatch(Batch))
+		{
+			IsHealthy = false;
+			std::lock_guard Lock(m_Mutex);
+			m_IsAccepting = false;
+			m_Pending.clear();
+			m_PendingBytes = 0;
+		}
+		Recycle(Batch);
+		Batch.clear();
+	}
+}
+
+bool CoalescingWriter::WriteBatch(const std::vector<std::string>& InBatch)
+{
+#if defined(_WIN32)
+	std::string Buffer;
+	for (const std::string& Message : InBatch)
+	{
+		Buffer.append(Message).append(m_Delimiter);
+	}
+
+	std::size_t Offset{ 0 };
+	while (Offset < Buffer.size())
+	{
+		DWORD Written{ 0 };
+		if (!WriteFile(m_Handle, Buffer.data() + Offset, static_cast<DWORD>(Buffer.size() - Offset), &Written, nullptr))
+		{
+			HandleRuntimeError("Error writing to stdio handle: " + std::to_string(GetLastError()));
+			return false;
+		}
+		Offset += Written;
+	}
+	return true;
+#else
+	std::vector<iovec> Vectors;
+	Vectors.reserve(InBatch.size() * 2);
+	for (const std::string& Message : InBatch)
+	{
+		Vectors.push_back({ const_cast<char*>(Message.data()), Message.size() });
+		if (!m_Delimiter.empty())
+		{
+			Vectors.push_back({ m_Delimiter.data(), m_Delimiter.size() });
+		}
+	}
+
+	std::size_t Index{ 0 };
+	while (Index < Vectors.size())
+	{
+		const int Count = static_cast<int>(std::min<std::size_t>(Vectors.size() - Index, IOV_MAX));
+		ssize_t Written = writev(m_Handle, Vectors.data() + Index, Count);
+		if (Written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			HandleRuntimeError("Error writing to stdio handle: " + std::to_string(errno));
+			return false;
+		}
+
+		// Skip fully written vectors and trim a partially written one
+		while (Index < Vectors.size() && static_cast<std::size_t>(Written) >= Vectors[Index].iov_len)
+		{
+			Written -= static_cast<ssize_t>(Vectors[Index].iov_len);
+			++Index;
+		}
+		if (Written > 0)
+		{
+			Vectors[Index].iov_base = static_cast<char*>(Vectors[Index].iov_base) + Written;
+			Vectors[Index].iov_len -= static_cast<std::size_t>(Written);
+		}
+	}
+	return true;
+#endif
+}
+
+MCP_NAMESPACE_END
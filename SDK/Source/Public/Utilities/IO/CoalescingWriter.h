@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/IO/NativeHandle.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Single-writer outbound queue for a pipe or standard stream.
+ * Producers enqueue serialized messages without touching the handle; one writer thread drains everything that is
+ * pending on each wakeup and submits it with a single writev(), appending the delimiter per message so callers
+ * never have to concatenate it themselves.
+ */
+class CoalescingWriter
+{
+public:
+	/**
+	 * @param InHandle The handle to write to. Ownership stays with the caller.
+	 * @param InFlushLatency How long the writer waits for more messages after the first one arrives. Zero writes
+	 * as soon as the writer wakes, while still batching whatever queued up during the previous write.
+	 * @param InMaxBatchBytes Upper bound on the bytes submitted per write call
+	 * @param InDelimiter Bytes written after every message
+	 */
+	CoalescingWriter(NativeHandle InHandle,
+		std::chrono::microseconds InFlushLatency,
+		std::size_t InMaxBatchBytes,
+		std::string_view InDelimiter = "\n");
+	~CoalescingWriter() noexcept;
+	CoalescingWriter(const CoalescingWriter&) = delete;
+	CoalescingWriter(CoalescingWriter&&) = delete;
+	CoalescingWriter& operator=(const CoalescingWriter&) = delete;
+	CoalescingWriter& operator=(CoalescingWriter&&) = delete;
+
+	void Start();
+
+	// Write out everything still queued, then stop the writer thread
+	void Stop();
+
+	/**
+	 * Queue a message for writing.
+	 * @param InMessage The serialized message, without delimiter
+	 * @return False if the writer is stopped or the handle has failed
+	 */
+	bool Enqueue(std::string InMessage);
+
+	/**
+	 * An empty string to serialize the next message into. Buffers come back from messages already written, so they
+	 * usually have the capacity for it without allocating.
+	 */
+	[[nodiscard]] std::string AcquireBuffer();
+
+private:
+	// Written buffers kept for reuse, and the largest capacity worth keeping
+	static constexpr std::size_t MAX_SPARE_BUFFERS{ 64 };
+	static constexpr std::size_t MAX_SPARE_CAPACITY{ 64 * 1024 };
+
+	// Hand written buffers back for AcquireBuffer()
+	void Recycle(std::vector<std::string>& InBatch);
+
+	void WriteLoop(const std::stop_token& InStopToken);
+	bool WriteBatch(const std::vector<std::string>& InBatch);
+
+	NativeHandle m_Handle;
+	std::chrono::microseconds m_FlushLatency;
+	std::size_t m_MaxBatchBytes;
+	std::string m_Delimiter;
+
+	std::mutex m_Mutex;
+	std::condition_variable_any m_Wake;
+	std::deque<std::string> m_Pending;
+	std::size_t m_PendingBytes{ 0 };
+	bool m_IsAccepting{ false };
+	std::vector<std::string> m_SpareBuffers;
+
+	std::jthread m_Thread;
+};
+
+MCP_NAMESPACE_END
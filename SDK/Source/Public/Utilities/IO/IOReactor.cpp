@@ -0,0 +1,573 @@
+#include "Utilities/IO/IOReactor.h"
+
+#if !defined(_WIN32)
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#if defined(__linux__)
+		#include <sys/epoll.h>
+		#include <sys/eventfd.h>
+	#else
+		#include <poll.h>
+	#endif
+#endif
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "CoreSDK/Common/RuntimeError.h"
+
+MCP_NAMESPACE_BEGIN
+
+namespace
+{
+	// Identifier reserved for the loop's own wake handle
+	constexpr uint64_t WAKE_ID{ 0 };
+
+	// Set on the loop threads of every reactor, so work reaching them can tell it must not block
+	thread_local bool t_IsLoopThread{ false };
+
+#if defined(__linux__)
+	uint32_t ToNative(const EIOEvent InInterest)
+	{
+		uint32_t Events{ 0 };
+		if (HasIOEvent(InInterest, EIOEvent::Readable))
+		{
+			Events |= EPOLLIN | EPOLLRDHUP;
+		}
+		if (HasIOEvent(InInterest, EIOEvent::Writable))
+		{
+			Events |= EPOLLOUT;
+		}
+		return Events;
+	}
+
+	EIOEvent FromNative(const uint32_t InEvents)
+	{
+		EIOEvent Events{ EIOEvent::None };
+		if ((InEvents & EPOLLIN) != 0)
+		{
+			Events = Events | EIOEvent::Readable;
+		}
+		if ((InEvents & EPOLLOUT) != 0)
+		{
+			Events = Events | EIOEvent::Writable;
+		}
+		if ((InEvents & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) != 0)
+		{
+			Events = Events | EIOEvent::Closed;
+		}
+		return Events;
+	}
+#elif !defined(_WIN32)
+	short ToNative(const EIOEvent InInterest)
+	{
+		short Events{ 0 };
+		if (HasIOEvent(InInterest, EIOEvent::Readable))
+		{
+			Events |= POLLIN;
+		}
+		if (HasIOEvent(InInterest, EIOEvent::Writable))
+		{
+			Events |= POLLOUT;
+		}
+		return Events;
+	}
+
+	EIOEvent FromNative(const short InEvents)
+	{
+		EIOEvent Events{ EIOEvent::None };
+		if ((InEvents & POLLIN) != 0)
+		{
+			Events = Events | EIOEvent::Readable;
+		}
+		if ((InEvents & POLLOUT) != 0)
+		{
+			Events = Events | EIOEvent::Writable;
+		}
+		if ((InEvents & (POLLHUP | POLLERR | POLLNVAL)) != 0)
+		{
+			Events = Events | EIOEvent::Closed;
+		}
+		return Events;
+	}
+#endif
+} // namespace
+
+IOReactor::IOReactor(const std::size_t InThreadCount)
+{
+#if defined(_WIN32)
+	(void)InThreadCount;
+#else
+	for (std::size_t Index = 0; Index < std::max<std::size_t>(InThreadCount, 1); ++Index)
+	{
+		auto NewLoop = std::make_unique<Loop>();
+
+	#if defined(__linux__)
+		NewLoop->PollHandle = epoll_create1(EPOLL_CLOEXEC);
+		NewLoop->WakeRead = NewLoop->WakeWrite = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+		if (NewLoop->PollHandle < 0 || NewLoop->WakeRead < 0)
+		{
+			HandleRuntimeError("Failed to create I/O reactor loop: " + std::to_string(errno));
+			close(NewLoop->PollHandle);
+			close(NewLoop->WakeRead);
+			continue;
+		}
+		epoll_event WakeEvent{};
+		WakeEvent.events = EPOLLIN;
+		WakeEvent.data.u64 = WAKE_ID;
+		epoll_ctl(NewLoop->PollHandle, EPOLL_CTL_ADD, NewLoop->WakeRead, &WakeEvent);
+	#else
+		int WakePipe[2];
+		if (pipe(WakePipe) != 0)
+		{
+			HandleRuntimeError("Failed to create I/O reactor loop: " + std::to_string(errno));
+			continue;
+		}
+		NewLoop->WakeRead = WakePipe[0];
+		NewLoop->WakeWrite = WakePipe[1];
+		for (const int Handle : WakePipe)
+		{
+			fcntl(Handle, F_SETFD, FD_CLOEXEC);
+			fcntl(Handle, F_SETFL, fcntl(Handle, F_GETFL) | O_NONBLOCK);
+		}
+		NewLoop->IsDirty = true;
+	#endif
+
+		Loop& LoopRef = *NewLoop;
+		NewLoop->Thread
+			= std::jthread([this, &LoopRef](const std::stop_token& InStopToken) { Run(LoopRef, InStopToken); });
+		m_Loops.emplace_back(std::move(NewLoop));
+	}
+#endif
+}
+
+IOReactor::~IOReactor() noexcept
+{
+	for (const std::unique_ptr<Loop>& CurrentLoop : m_Loops)
+	{
+		CurrentLoop->Thread.request_stop();
+		Wake(*CurrentLoop);
+		if (CurrentLoop->Thread.joinable())
+		{
+			CurrentLoop->Thread.join();
+		}
+
+#if !defined(_WIN32)
+		if (CurrentLoop->WakeWrite != CurrentLoop->WakeRead)
+		{
+			close(CurrentLoop->WakeWrite);
+		}
+		close(CurrentLoop->WakeRead);
+		if (CurrentLoop->PollHandle >= 0)
+		{
+			close(CurrentLoop->PollHandle);
+		}
+#endif
+	}
+}
+
+IOReactor& IOReactor::Shared()
+{
+	static IOReactor Instance;
+	return Instance;
+}
+
+bool IOReactor::IsLoopThread() { return t_IsLoopThread; }
+
+bool IOReactor::IsSupported()
+{
+#if defined(_WIN32)
+	return false;
+#else
+	return true;
+#endif
+}
+
+bool IOReactor::Watch(const NativeHandle InHandle, const EIOEvent InInterest, Handler InHandler)
+{
+	if (m_Loops.empty())
+	{
+		return false;
+	}
+
+	auto NewRegistration = std::make_shared<Registration>();
+	NewRegistration->ID = m_NextID++;
+	NewRegistration->Handle = InHandle;
+	NewRegistration->Interest = InInterest;
+	NewRegistration->OnEvent = std::move(InHandler);
+	NewRegistration->Owner = m_Loops[m_NextLoop++ % m_Loops.size()].get();
+
+	{
+		std::lock_guard Lock(m_Mutex);
+		if (!m_ByHandle.emplace(InHandle, NewRegistration).second)
+		{
+			HandleRuntimeError("Handle is already watched by the I/O reactor");
+			return false;
+		}
+	}
+
+	Loop& Owner = *NewRegistration->Owner;
+	{
+		std::lock_guard Lock(Owner.Mutex);
+		Owner.Registrations.emplace(NewRegistration->ID, NewRegistration);
+		if (Apply(Owner, *NewRegistration, true))
+		{
+			return true;
+		}
+		Owner.Registrations.erase(NewRegistration->ID);
+	}
+
+	std::lock_guard Lock(m_Mutex);
+	m_ByHandle.erase(InHandle);
+	return false;
+}
+
+bool IOReactor::Modify(const NativeHandle InHandle, const EIOEvent InInterest)
+{
+	std::shared_ptr<Registration> Target;
+	{
+		std::lock_guard Lock(m_Mutex);
+		const auto Iter = m_ByHandle.find(InHandle);
+		if (Iter == m_ByHandle.end())
+		{
+			return false;
+		}
+		Target = Iter->second;
+	}
+
+	std::lock_guard Lock(Target->Owner->Mutex);
+	Target->Interest = InInterest;
+	return Apply(*Target->Owner, *Target, false);
+}
+
+void IOReactor::Unwatch(const NativeHandle InHandle) { Remove(InHandle, true); }
+
+void IOReactor::Remove(const NativeHandle InHandle, const bool InWaitForCallback)
+{
+	std::shared_ptr<Registration> Target;
+	{
+		std::lock_guard Lock(m_Mutex);
+		const auto Iter = m_ByHandle.find(InHandle);
+		if (Iter == m_ByHandle.end())
+		{
+			return;
+		}
+		Target = std::move(Iter->second);
+		m_ByHandle.erase(Iter);
+	}
+
+	Loop& Owner = *Target->Owner;
+	std::unique_lock Lock(Owner.Mutex);
+	Owner.Registrations.erase(Target->ID);
+#if defined(__linux__)
+	// Fails harmlessly if the caller already closed the handle
+	epoll_ctl(Owner.PollHandle, EPOLL_CTL_DEL, InHandle, nullptr);
+#else
+	Owner.IsDirty = true;
+	Wake(Owner);
+#endif
+
+	if (InWaitForCallback && Owner.Thread.get_id() != std::this_thread::get_id())
+	{
+		Owner.Idle.wait(Lock, [&Owner, &Target] { return Owner.RunningID != Target->ID; });
+	}
+}
+
+std::size_t IOReactor::GetWatchCount() const
+{
+	std::lock_guard Lock(m_Mutex);
+	return m_ByHandle.size();
+}
+
+IOReactor::ReadyAwaiter::ReadyAwaiter(IOReactor& InReactor, const NativeHandle InHandle, const EIOEvent InInterest)
+	: m_Reactor(InReactor),
+	  m_Handle(InHandle),
+	  m_Interest(InInterest)
+{}
+
+bool IOReactor::ReadyAwaiter::await_suspend(const std::coroutine_handle<> InAwaiter)
+{
+	m_Awaiter = InAwaiter;
+	const bool IsParked = m_Reactor.Park(*this);
+	if (!IsParked)
+	{
+		m_IsDone = true;
+		m_Result = m_Interest;
+	}
+	return IsParked;
+}
+
+bool IOReactor::ReadyAwaiter::Cancel()
+{
+	if (!m_Awaiter || m_IsDone.exchange(true))
+	{
+		return false;
+	}
+	// Callbacks only reach a waiter through its set, so once it is out of the set nothing touches it
+	m_Reactor.Unpark(*this);
+	m_Result = EIOEvent::None;
+	m_Awaiter.resume();
+	return true;
+}
+
+bool IOReactor::Park(ReadyAwaiter& InWaiter)
+{
+	std::lock_guard Lock(m_WaitMutex);
+	auto [Iter, IsNew] = m_Waiters.try_emplace(InWaiter.m_Handle);
+	if (IsNew)
+	{
+		Iter->second = std::make_shared<WaitSet>();
+	}
+
+	ReadyAwaiter*& Slot = Iter->second->SlotFor(InWaiter.m_Interest);
+	if (Slot != nullptr)
+	{
+		HandleRuntimeError("A coroutine is already waiting on this handle for the same event");
+		return false;
+	}
+	Slot = &InWaiter;
+
+	const EIOEvent Interest = Iter->second->GetInterest();
+	const bool IsWatched = IsNew
+		? Watch(InWaiter.m_Handle,
+			  Interest,
+			  [this, Set = Iter->second, Handle = InWaiter.m_Handle](const EIOEvent InEvents)
+			  { OnWaitReady(Set, Handle, InEvents); })
+		: Modify(InWaiter.m_Handle, Interest);
+	if (!IsWatched)
+	{
+		Slot = nullptr;
+		if (IsNew)
+		{
+			m_Waiters.erase(Iter);
+		}
+	}
+	return IsWatched;
+}
+
+void IOReactor::Unpark(ReadyAwaiter& InWaiter)
+{
+	std::lock_guard Lock(m_WaitMutex);
+	const auto Iter = m_Waiters.find(InWaiter.m_Handle);
+	if (Iter == m_Waiters.end())
+	{
+		return;
+	}
+	// A callback may have cleared the slot already, after this waiter had won the race to complete the wait
+	if (ReadyAwaiter*& Slot = Iter->second->SlotFor(InWaiter.m_Interest); Slot == &InWaiter)
+	{
+		Slot = nullptr;
+		UpdateWaitSet(Iter);
+	}
+}
+
+void IOReactor::OnWaitReady(const std::shared_ptr<WaitSet>& InSet, const NativeHandle InHandle, const EIOEvent InEvents)
+{
+	std::array<std::coroutine_handle<>, 2> Ready{};
+	std::size_t ReadyCount{ 0 };
+	{
+		std::lock_guard Lock(m_WaitMutex);
+		const auto Iter = m_Waiters.find(InHandle);
+		if (Iter == m_Waiters.end() || Iter->second != InSet)
+		{
+			// The set was retired while this event was in flight
+			return;
+		}
+
+		// A closed handle ends every wait, so the next read or write reports why
+		const auto Take = [InEvents, &Ready, &ReadyCount](ReadyAwaiter*& InSlot, const EIOEvent InDirection)
+		{
+			if (InSlot == nullptr || (!HasIOEvent(InEvents, InDirection) && !HasIOEvent(InEvents, EIOEvent::Closed)))
+			{
+				return;
+			}
+			if (!InSlot->m_IsDone.exchange(true))
+			{
+				InSlot->m_Result = InEvents;
+				Ready[ReadyCount++] = InSlot->m_Awaiter;
+			}
+			InSlot = nullptr;
+		};
+		Take(InSet->Reader, EIOEvent::Readable);
+		Take(InSet->Writer, EIOEvent::Writable);
+		UpdateWaitSet(Iter);
+	}
+
+	for (std::size_t Index = 0; Index < ReadyCount; ++Index)
+	{
+		ThreadPool::Shared().Post([Awaiter = Ready[Index]] { Awaiter.resume(); });
+	}
+}
+
+void IOReactor::UpdateWaitSet(const WaitSetMap::iterator InIter)
+{
+	const NativeHandle Handle = InIter->first;
+	const EIOEvent Interest = InIter->second->GetInterest();
+	if (Interest != EIOEvent::None)
+	{
+		(void)Modify(Handle, Interest);
+		return;
+	}
+
+	// Callbacks wait on m_WaitMutex, which is held here, so the registration goes without waiting for them. One
+	// still in flight finds its set retired.
+	m_Waiters.erase(InIter);
+	Remove(Handle, false);
+}
+
+void IOReactor::Run(Loop& InLoop, const std::stop_token& InStopToken)
+{
+	t_IsLoopThread = true;
+
+#if defined(__linux__)
+	std::array<epoll_event, 64> Events{};
+	while (!InStopToken.stop_requested())
+	{
+		const int Count = epoll_wait(InLoop.PollHandle, Events.data(), static_cast<int>(Events.size()), -1);
+		if (Count < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			HandleRuntimeError("Error waiting on I/O reactor: " + std::to_string(errno));
+			break;
+		}
+
+		for (int Index = 0; Index < Count; ++Index)
+		{
+			if (Events[Index].data.u64 == WAKE_ID)
+			{
+				uint64_t Drained{ 0 };
+				(void)read(InLoop.WakeRead, &Drained, sizeof(Drained));
+				continue;
+			}
+			Dispatch(InLoop, Events[Index].data.u64, FromNative(Events[Index].events));
+		}
+	}
+#elif !defined(_WIN32)
+	std::vector<pollfd> Descriptors;
+	std::vector<uint64_t> IDs;
+	while (!InStopToken.stop_requested())
+	{
+		{
+			std::lock_guard Lock(InLoop.Mutex);
+			if (InLoop.IsDirty)
+			{
+				Descriptors.assign(1, { InLoop.WakeRead, POLLIN, 0 });
+				IDs.assign(1, WAKE_ID);
+				for (const auto& [ID, Entry] : InLoop.Registrations)
+				{
+					Descriptors.push_back({ Entry->Handle, ToNative(Entry->Interest), 0 });
+					IDs.push_back(ID);
+				}
+				InLoop.IsDirty = false;
+			}
+		}
+
+		if (poll(Descriptors.data(), Descriptors.size(), -1) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			HandleRuntimeError("Error waiting on I/O reactor: " + std::to_string(errno));
+			break;
+		}
+
+		for (std::size_t Index = 0; Index < Descriptors.size(); ++Index)
+		{
+			if (Descriptors[Index].revents == 0)
+			{
+				continue;
+			}
+			if (IDs[Index] == WAKE_ID)
+			{
+				char Drained[64];
+				while (read(InLoop.WakeRead, Drained, sizeof(Drained)) > 0) {}
+				continue;
+			}
+			Dispatch(InLoop, IDs[Index], FromNative(Descriptors[Index].revents));
+		}
+	}
+#else
+	(void)InLoop;
+	(void)InStopToken;
+#endif
+}
+
+void IOReactor::Dispatch(Loop& InLoop, const uint64_t InID, const EIOEvent InEvents)
+{
+	std::shared_ptr<Registration> Target;
+	{
+		std::lock_guard Lock(InLoop.Mutex);
+		const auto Iter = InLoop.Registrations.find(InID);
+		if (Iter == InLoop.Registrations.end())
+		{
+			// Unwatched while the event was in flight
+			return;
+		}
+		Target = Iter->second;
+		InLoop.RunningID = InID;
+	}
+
+	try
+	{
+		Target->OnEvent(InEvents);
+	}
+	catch (const std::exception& Except)
+	{
+		HandleRuntimeError("Error in I/O reactor callback: " + std::string(Except.what()));
+	}
+
+	{
+		std::lock_guard Lock(InLoop.Mutex);
+		InLoop.RunningID = 0;
+	}
+	InLoop.Idle.notify_all();
+}
+
+void IOReactor::Wake(const Loop& InLoop)
+{
+#if defined(__linux__)
+	constexpr uint64_t Signal{ 1 };
+	(void)write(InLoop.WakeWrite, &Signal, sizeof(Signal));
+#elif !defined(_WIN32)
+	constexpr char Signal{ 0 };
+	(void)write(InLoop.WakeWrite, &Signal, 1);
+#else
+	(void)InLoop;
+#endif
+}
+
+bool IOReactor::Apply(Loop& InLoop, const Registration& InRegistration, const bool InIsNew)
+{
+#if defined(__linux__)
+	epoll_event Event{};
+	Event.events = ToNative(InRegistration.Interest);
+	Event.data.u64 = InRegistration.ID;
+	if (epoll_ctl(InLoop.PollHandle, InIsNew ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, InRegistration.Handle, &Event) != 0)
+	{
+		HandleRuntimeError("Failed to register handle with I/O reactor: " + std::to_string(errno));
+		return false;
+	}
+	return true;
+#elif !defined(_WIN32)
+	(void)InRegistration;
+	(void)InIsNew;
+	InLoop.IsDirty = true;
+	Wake(InLoop);
+	return true;
+#else
+	(void)InLoop;
+	(void)InRegistration;
+	(void)InIsNew;
+	return false;
+#endif
+}
+
+MCP_NAMESPACE_END
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/Async/TimerWheel.h"
+#include "Utilities/IO/NativeHandle.h"
+
+MCP_NAMESPACE_BEGIN
+
+enum class EIOEvent : uint8_t
+{
+	None = 0,
+	Readable = 1 << 0,
+	Writable = 1 << 1,
+	Closed = 1 << 2, // Hang-up or error, reported regardless of the requested interest
+};
+
+constexpr EIOEvent operator|(const EIOEvent InLeft, const EIOEvent InRight)
+{
+	return static_cast<EIOEvent>(static_cast<uint8_t>(InLeft) | static_cast<uint8_t>(InRight));
+}
+
+constexpr bool HasIOEvent(const EIOEvent InEvents, const EIOEvent InFlag)
+{
+	return (static_cast<uint8_t>(InEvents) & static_cast<uint8_t>(InFlag)) != 0;
+}
+
+/**
+ * Readiness multiplexer shared by many handles.
+ * Each handle is assigned to one of a small, fixed set of loop threads, each blocking in epoll (poll() where epoll is
+ * unavailable) and invoking the handle's callback when it becomes ready. Notifications are level-triggered, so a
+ * callback may consume as much or as little as it likes per wakeup. Coroutines can instead co_await Readable(),
+ * Writable() or Sleep(), or read and write through an AsyncStream.
+ * Pipes cannot be multiplexed on Windows; IsSupported() returns false there and callers keep a thread per handle.
+ */
+class IOReactor
+{
+public:
+	using Handler = std::function<void(EIOEvent)>;
+
+	static constexpr std::size_t DEFAULT_THREAD_COUNT{ 2 };
+
+	explicit IOReactor(std::size_t InThreadCount = DEFAULT_THREAD_COUNT);
+	~IOReactor() noexcept;
+	IOReactor(const IOReactor&) = delete;
+	IOReactor(IOReactor&&) = delete;
+	IOReactor& operator=(const IOReactor&) = delete;
+	IOReactor& operator=(IOReactor&&) = delete;
+
+	// Process-wide reactor used by the transports
+	[[nodiscard]] static IOReactor& Shared();
+	[[nodiscard]] static bool IsSupported();
+	/**
+	 * Whether the calling thread is a loop thread of any reactor. Work that may block or run for long, such as a
+	 * message handler or a coroutine's continuation, is posted to the ThreadPool from there instead.
+	 */
+	[[nodiscard]] static bool IsLoopThread();
+
+	/**
+	 * Start watching a handle. The callback runs on a loop thread and must not block for long, since it holds up
+	 * every other handle assigned to the same loop.
+	 * @param InHandle The handle to watch. Ownership stays with the caller, who must Unwatch() before closing it.
+	 * @param InInterest The events to report
+	 * @param InHandler Invoked with the ready events
+	 * @return False if the handle is already watched or could not be registered
+	 */
+	bool Watch(NativeHandle InHandle, EIOEvent InInterest, Handler InHandler);
+
+	// Change the events reported for a watched handle
+	bool Modify(NativeHandle InHandle, EIOEvent InInterest);
+
+	/**
+	 * Stop watching a handle. Once this returns the callback is not running and will not be invoked again, unless
+	 * Unwatch() was called from inside that very callback.
+	 */
+	void Unwatch(NativeHandle InHandle);
+
+	[[nodiscard]] std::size_t GetWatchCount() const;
+
+	/**
+	 * Suspends the awaiting coroutine until a handle is ready, then resumes it on the shared ThreadPool so that
+	 * coroutine code never runs on a loop thread. The handle is watched only while a coroutine waits on it, and must
+	 * not be watched by anything else meanwhile. One coroutine may wait for it to be readable while another waits for
+	 * it to be writable; they share one registration. A handle that cannot be watched is reported ready at once, so
+	 * the caller's next read or write surfaces the actual error.
+	 */
+	class ReadyAwaiter
+	{
+	public:
+		ReadyAwaiter(IOReactor& InReactor, NativeHandle InHandle, EIOEvent InInterest);
+		ReadyAwaiter(const ReadyAwaiter&) = delete;
+		ReadyAwaiter(ReadyAwaiter&&) = delete;
+		ReadyAwaiter& operator=(const ReadyAwaiter&) = delete;
+		ReadyAwaiter& operator=(ReadyAwaiter&&) = delete;
+		~ReadyAwaiter() = default;
+
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+		[[nodiscard]] bool await_suspend(std::coroutine_handle<> InAwaiter);
+		// The events that ended the wait; None if it was cancelled
+		[[nodiscard]] EIOEvent await_resume() const noexcept { return m_Result; }
+
+		// Stop waiting and resume the awaiter on the calling thread. Returns false if the handle was already ready.
+		bool Cancel();
+
+	private:
+		IOReactor& m_Reactor;
+		NativeHandle m_Handle;
+		EIOEvent m_Interest;
+		EIOEvent m_Result{ EIOEvent::None };
+		// Taken by whichever of the readiness callback and Cancel completes the wait
+		std::atomic<bool> m_IsDone{ false };
+		std::coroutine_handle<> m_Awaiter;
+
+		friend class IOReactor;
+	};
+
+	// `co_await Reactor.Readable(Handle);` waits until Handle can be read without blocking
+	[[nodiscard]] ReadyAwaiter Readable(const NativeHandle InHandle)
+	{
+		return ReadyAwaiter{ *this, InHandle, EIOEvent::Readable };
+	}
+	// `co_await Reactor.Writable(Handle);` waits until Handle can be written without blocking
+	[[nodiscard]] ReadyAwaiter Writable(const NativeHandle InHandle)
+	{
+		return ReadyAwaiter{ *this, InHandle, EIOEvent::Writable };
+	}
+	// `co_await Reactor.Sleep(Delay);` suspends the calling coroutine for Delay, on the shared TimerWheel
+	[[nodiscard]] static TimerWheel::SleepAwaiter Sleep(const std::chrono::milliseconds InDelay)
+	{
+		return TimerWheel::Shared().Sleep(InDelay);
+	}
+
+private:
+	struct Loop;
+
+	struct Registration
+	{
+		uint64_t ID{ 0 };
+		NativeHandle Handle{};
+		EIOEvent Interest{ EIOEvent::None };
+		Handler OnEvent;
+		Loop* Owner{ nullptr };
+	};
+
+	struct Loop
+	{
+		int PollHandle{ -1 };
+		int WakeRead{ -1 };
+		int WakeWrite{ -1 };
+		std::mutex Mutex;
+		std::condition_variable Idle;
+		std::unordered_map<uint64_t, std::shared_ptr<Registration>> Registrations;
+		uint64_t RunningID{ 0 };
+		bool IsDirty{ false }; // poll() fallback: descriptor set needs rebuilding
+		std::jthread Thread;
+	};
+
+	/**
+	 * The coroutines parked on one handle, at most one per direction. The handle is watched for the union of their
+	 * interests, so a pending read does not keep a write from waiting, or the other way around.
+	 */
+	struct WaitSet
+	{
+		ReadyAwaiter* Reader{ nullptr };
+		ReadyAwaiter* Writer{ nullptr };
+
+		[[nodiscard]] ReadyAwaiter*& SlotFor(const EIOEvent InInterest)
+		{
+			return InInterest == EIOEvent::Writable ? Writer : Reader;
+		}
+		[[nodiscard]] EIOEvent GetInterest() const
+		{
+			return (Reader != nullptr ? EIOEvent::Readable : EIOEvent::None)
+				| (Writer != nullptr ? EIOEvent::Writable : EIOEvent::None);
+		}
+	};
+	using WaitSetMap = std::unordered_map<NativeHandle, std::shared_ptr<WaitSet>>;
+
+	// Add a waiter to its handle's set, watching the handle for it. False if it cannot wait.
+	bool Park(ReadyAwaiter& InWaiter);
+	// Take a waiter that was cancelled out of its handle's set
+	void Unpark(ReadyAwaiter& InWaiter);
+	void OnWaitReady(const std::shared_ptr<WaitSet>& InSet, NativeHandle InHandle, EIOEvent InEvents);
+	// Watch the handle for what its set still waits on, or stop watching it once nobody waits; m_WaitMutex is held
+	void UpdateWaitSet(WaitSetMap::iterator InIter);
+	// Unwatch, optionally without waiting for a callback in progress
+	void Remove(NativeHandle InHandle, bool InWaitForCallback);
+
+	void Run(Loop& InLoop, const std::stop_token& InStopToken);
+	void Dispatch(Loop& InLoop, uint64_t InID, EIOEvent InEvents);
+	static void Wake(const Loop& InLoop);
+	static bool Apply(Loop& InLoop, const Registration& InRegistration, bool InIsNew);
+
+	std::vector<std::unique_ptr<Loop>> m_Loops;
+	mutable std::mutex m_Mutex;
+	std::unordered_map<NativeHandle, std::shared_ptr<Registration>> m_ByHandle;
+	std::atomic<uint64_t> m_NextID{ 1 };
+	// Guards m_Waiters and the waiters parked in it. Taken before m_Mutex and a loop's mutex, never after them.
+	std::mutex m_WaitMutex;
+	WaitSetMap m_Waiters;
+	std::atomic<std::size_t> m_NextLoop{ 0 };
+};
+
+MCP_NAMESPACE_END
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "CoreSDK/Common/RuntimeError.h"
+#include "Utilities/JSON/WireFormat.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Frames newline-delimited messages out of a reusable byte buffer, along with any length-prefixed BinaryFrame mixed
+ * in between them.
+ * Readers write straight into the tail returned by PrepareWrite() and every complete line is handed out as a view
+ * into the buffer, so once the buffer has grown to fit the largest message no per-message allocation takes place.
+ * Consumed bytes are reclaimed by compacting the partial tail to the front instead of wrapping, which keeps every
+ * frame contiguous.
+ */
+class LineFramer
+{
+public:
+	static constexpr std::size_t DEFAULT_CAPACITY{ 64 * 1024 };
+	static constexpr std::size_t DEFAULT_MAX_FRAME_SIZE{ 64 * 1024 * 1024 };
+	static constexpr std::size_t DEFAULT_READ_SIZE{ 16 * 1024 };
+
+	explicit LineFramer(const std::size_t InInitialCapacity = DEFAULT_CAPACITY,
+		const std::size_t InMaxFrameSize = DEFAULT_MAX_FRAME_SIZE)
+		: m_Buffer(InInitialCapacity),
+		  m_MaxFrameSize(InMaxFrameSize)
+	{}
+
+	/**
+	 * Reserve room for at least InMinimum bytes at the end of the buffer.
+	 * @param InMinimum The number of bytes the caller wants to read
+	 * @return The writable tail of the buffer
+	 */
+	[[nodiscard]] std::span<char> PrepareWrite(const std::size_t InMinimum = DEFAULT_READ_SIZE)
+	{
+		if (m_Buffer.size() - m_WritePos < InMinimum)
+		{
+			Compact();
+		}
+		if (m_Buffer.size() - m_WritePos < InMinimum)
+		{
+			m_Buffer.resize(std::max(m_Buffer.size() * 2, m_WritePos + InMinimum));
+		}
+		return { m_Buffer.data() + m_WritePos, m_Buffer.size() - m_WritePos };
+	}
+
+	// Mark InCount bytes of the span returned by PrepareWrite() as filled
+	void CommitWrite(const std::size_t InCount) { m_WritePos += InCount; }
+
+	// Copy bytes that were read elsewhere into the framer
+	void Append(const std::string_view InBytes)
+	{
+		const std::span<char> Tail = PrepareWrite(InBytes.size());
+		std::memcpy(Tail.data(), InBytes.data(), InBytes.size());
+		CommitWrite(InBytes.size());
+	}
+
+	/**
+	 * Hand every complete line to OnFrame. Trailing '\r' is stripped and blank lines are skipped. A binary frame is
+	 * handed over whole, header included, and tells itself apart from text by its first byte.
+	 * The view is only valid for the duration of the callback.
+	 * @param OnFrame Callable taking a std::string_view
+	 * @return The number of frames delivered
+	 */
+	template <typename Function> std::size_t ConsumeFrames(Function&& OnFrame)
+	{
+		std::size_t Delivered{ 0 };
+		while (m_ScanPos < m_WritePos)
+		{
+			if (m_DiscardBytes > 0)
+			{
+				const std::size_t Skipped = std::min(m_DiscardBytes, m_WritePos - m_ReadPos);
+				m_DiscardBytes -= Skipped;
+				m_ReadPos = m_ScanPos = m_ReadPos + Skipped;
+				continue;
+			}
+
+			// A binary frame can only start where a line would
+			if (m_ScanPos == m_ReadPos && !m_Discarding && BinaryFrame::IsTag(m_Buffer[m_ReadPos]))
+			{
+				const std::size_t Available = m_WritePos - m_ReadPos;
+				if (Available < BinaryFrame::HEADER_SIZE)
+				{
+					break;
+				}
+				const std::size_t FrameSize
+					= BinaryFrame::GetFrameSize({ m_Buffer.data() + m_ReadPos, BinaryFrame::HEADER_SIZE });
+				if (FrameSize > m_MaxFrameSize)
+				{
+					// Its size is known, so the frame is skipped as it arrives
+					HandleRuntimeError("Discarding oversized frame");
+					m_DiscardBytes = FrameSize;
+					continue;
+				}
+				if (Available < FrameSize)
+				{
+					break;
+				}
+
+				const std::string_view Frame{ m_Buffer.data() + m_ReadPos, FrameSize };
+				m_ReadPos = m_ScanPos = m_ReadPos + FrameSize;
+				OnFrame(Frame);
+				++Delivered;
+				continue;
+			}
+
+			const char* Begin = m_Buffer.data() + m_ScanPos;
+			const auto* NewLine = static_cast<const char*>(std::memchr(Begin, '\n', m_WritePos - m_ScanPos));
+			if (NewLine == nullptr)
+			{
+				m_ScanPos = m_WritePos;
+				break;
+			}
+
+			const std::size_t LineEnd = static_cast<std::size_t>(NewLine - m_Buffer.data());
+			std::string_view Line{ m_Buffer.data() + m_ReadPos, LineEnd - m_ReadPos };
+			m_ReadPos = LineEnd + 1;
+			m_ScanPos = m_ReadPos;
+
+			if (m_Discarding)
+			{
+				// Tail end of an oversized frame
+				m_Discarding = false;
+				continue;
+			}
+
+			if (!Line.empty() && Line.back() == '\r')
+			{
+				Line.remove_suffix(1);
+			}
+			if (!Line.empty())
+			{
+				OnFrame(Line);
+				++Delivered;
+			}
+		}
+
+		if (m_ReadPos == m_WritePos)
+		{
+			m_ReadPos = m_WritePos = m_ScanPos = 0;
+		}
+		else if (m_WritePos - m_ReadPos > m_MaxFrameSize)
+		{
+			// Drop the partial frame rather than growing without bound; the rest of it is skipped on arrival
+			HandleRuntimeError("Discarding oversized frame");
+			m_ReadPos = m_WritePos = m_ScanPos = 0;
+			m_Discarding = true;
+		}
+		return Delivered;
+	}
+
+	[[nodiscard]] std::size_t GetBufferedSize() const { return m_WritePos - m_ReadPos; }
+
+	void Reset()
+	{
+		m_ReadPos = m_WritePos = m_ScanPos = 0;
+		m_DiscardBytes = 0;
+		m_Discarding = false;
+	}
+
+private:
+	void Compact()
+	{
+		if (m_ReadPos == 0)
+		{
+			return;
+		}
+		const std::size_t Pending = m_WritePos - m_ReadPos;
+		std::memmove(m_Buffer.data(), m_Buffer.data() + m_ReadPos, Pending);
+		m_ScanPos -= m_ReadPos;
+		m_ReadPos = 0;
+		m_WritePos = Pending;
+	}
+
+	std::vector<char> m_Buffer;
+	std::size_t m_ReadPos{ 0 };
+	std::size_t m_WritePos{ 0 };
+	std::size_t m_ScanPos{ 0 };
+	std::size_t m_MaxFrameSize;
+	// Bytes of an oversized binary frame still to be skipped
+	std::size_t m_DiscardBytes{ 0 };
+	bool m_Discarding{ false };
+};
+
+MCP_NAMESPACE_END
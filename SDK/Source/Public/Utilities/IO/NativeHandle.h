@@ -0,0 +1,14 @@
+#pragma once
+
+#include "CoreSDK/Common/Macros.h"
+
+MCP_NAMESPACE_BEGIN
+
+// Platform handle for pipes and standard streams. Matches Poco::Pipe::Handle so pipe ends can be handed over as-is.
+#if defined(_WIN32)
+using NativeHandle = void*;
+#else
+using NativeHandle = int;
+#endif
+
+MCP_NAMESPACE_END
@@ -0,0 +1,254 @@
+#include "Utilities/IO/StdioReader.h"
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <poll.h>
+	#include <unistd.h>
+#endif
+
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "CoreSDK/Common/RuntimeError.h"
+
+MCP_NAMESPACE_BEGIN
+
+StdioReader::State::State(const NativeHandle InHandle,
+	FrameCallback InOnFrame,
+	CloseCallback InOnClose,
+	IOReactor* InReactor)
+	: Handle(InHandle),
+	  OnFrame(std::move(InOnFrame)),
+	  OnClose(std::move(InOnClose)),
+	  Reactor(IOReactor::IsSupported() ? InReactor : nullptr)
+{}
+
+StdioReader::State::~State() noexcept
+{
+#if !defined(_WIN32)
+	if (WakeRead >= 0)
+	{
+		close(WakeRead);
+		close(WakeWrite);
+	}
+#endif
+}
+
+StdioReader::StdioReader(const NativeHandle InHandle,
+	FrameCallback InOnFrame,
+	CloseCallback InOnClose,
+	IOReactor* InReactor)
+	: m_State(std::make_shared<State>(InHandle, std::move(InOnFrame), std::move(InOnClose), InReactor))
+{}
+
+StdioReader::~StdioReader() noexcept
+{
+	try
+	{
+		Stop();
+		if (m_Thread.joinable() && IsReaderThread())
+		{
+			// Destroyed from inside a callback: the loop owns its state and exits once the callback returns
+			m_Thread.detach();
+		}
+	}
+	catch (...)
+	{
+		// Ignore errors during destruction
+	}
+}
+
+void StdioReader::Start()
+{
+	if (m_State->IsRunning.exchange(true))
+	{
+		return;
+	}
+	m_State->IsStopping = false;
+
+#if !defined(_WIN32)
+	if (m_State->Reactor)
+	{
+		fcntl(m_State->Handle, F_SETFL, fcntl(m_State->Handle, F_GETFL) | O_NONBLOCK);
+		if (!m_State->Reactor->Watch(m_State->Handle,
+				EIOEvent::Readable,
+				[Shared = m_State](EIOEvent) { OnReadable(*Shared); }))
+		{
+			m_State->IsRunning = false;
+			HandleRuntimeError("Failed to watch stdio handle");
+		}
+		return;
+	}
+
+	int WakePipe[2];
+	if (pipe(WakePipe) != 0)
+	{
+		m_State->IsRunning = false;
+		HandleRuntimeError("Failed to create reader wake pipe");
+		return;
+	}
+	m_State->WakeRead = WakePipe[0];
+	m_State->WakeWrite = WakePipe[1];
+	fcntl(m_State->WakeRead, F_SETFD, FD_CLOEXEC);
+	fcntl(m_State->WakeWrite, F_SETFD, FD_CLOEXEC);
+#endif
+
+	m_Thread = std::jthread([Shared = m_State] { ReadLoop(Shared); });
+}
+
+void StdioReader::Stop()
+{
+	m_State->IsStopping = true;
+
+	if (m_State->Reactor)
+	{
+		// Does not wait when called from the callback, whose registration keeps the state alive until it returns
+		m_State->Reactor->Unwatch(m_State->Handle);
+		m_State->IsRunning = false;
+		return;
+	}
+
+	if (!m_Thread.joinable() || IsReaderThread())
+	{
+		// Stopped from inside a callback: the loop sees the flag once it returns, and the owning thread joins later
+		return;
+	}
+
+#if defined(_WIN32)
+	CancelSynchronousIo(m_Thread.native_handle());
+#else
+	constexpr char Wake{ 0 };
+	(void)write(m_State->WakeWrite, &Wake, 1);
+#endif
+	m_Thread.join();
+
+#if !defined(_WIN32)
+	close(m_State->WakeRead);
+	close(m_State->WakeWrite);
+	m_State->WakeRead = m_State->WakeWrite = -1;
+#endif
+}
+
+void StdioReader::ReadLoop(const std::shared_ptr<State>& InState)
+{
+	State& Reader = *InState;
+	while (!Reader.IsStopping)
+	{
+		const std::span<char> Tail = Reader.Framer.PrepareWrite();
+
+#if defined(_WIN32)
+		DWORD BytesRead{ 0 };
+		if (!ReadFile(Reader.Handle, Tail.data(), static_cast<DWORD>(Tail.size()), &BytesRead, nullptr)
+			|| BytesRead == 0)
+		{
+			break;
+		}
+		const auto Count = static_cast<std::ptrdiff_t>(BytesRead);
+#else
+		pollfd Descriptors[2]{ { Reader.Handle, POLLIN, 0 }, { Reader.WakeRead, POLLIN, 0 } };
+		if (poll(Descriptors, 2, -1) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			HandleRuntimeError("Error polling stdio handle: " + std::to_string(errno));
+			break;
+		}
+		if (Descriptors[1].revents != 0 || Reader.IsStopping)
+		{
+			break;
+		}
+
+		const auto Count = read(Reader.Handle, Tail.data(), Tail.size());
+		if (Count < 0)
+		{
+			if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				continue;
+			}
+			HandleRuntimeError("Error reading stdio handle: " + std::to_string(errno));
+			break;
+		}
+		if (Count == 0)
+		{
+			// Peer closed its end
+			break;
+		}
+#endif
+
+		DeliverFrames(Reader, static_cast<std::size_t>(Count));
+	}
+
+	if (!Reader.IsStopping.exchange(true) && Reader.OnClose)
+	{
+		Reader.OnClose();
+	}
+	Reader.IsRunning = false;
+}
+
+void StdioReader::OnReadable(State& InState)
+{
+#if !defined(_WIN32)
+	for (int Attempt = 0; Attempt < MAX_READS_PER_WAKEUP && !InState.IsStopping; ++Attempt)
+	{
+		const std::span<char> Tail = InState.Framer.PrepareWrite();
+		const auto Count = read(InState.Handle, Tail.data(), Tail.size());
+		if (Count < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				return;
+			}
+			HandleRuntimeError("Error reading stdio handle: " + std::to_string(errno));
+		}
+		if (Count <= 0)
+		{
+			// Peer closed its end, or the handle failed
+			InState.Reactor->Unwatch(InState.Handle);
+			InState.IsRunning = false;
+			if (!InState.IsStopping.exchange(true) && InState.OnClose)
+			{
+				InState.OnClose();
+			}
+			return;
+		}
+
+		DeliverFrames(InState, static_cast<std::size_t>(Count));
+	}
+#else
+	(void)InState;
+#endif
+}
+
+void StdioReader::DeliverFrames(State& InState, const std::size_t InCount)
+{
+	InState.Framer.CommitWrite(InCount);
+	InState.Framer.ConsumeFrames(
+		[&InState](const std::string_view InFrame)
+		{
+			if (InState.IsStopping)
+			{
+				// The owner stopped reading, and may already be gone, from an earlier frame
+				return;
+			}
+			try
+			{
+				InState.OnFrame(InFrame);
+			}
+			catch (const std::exception& Except)
+			{
+				HandleRuntimeError("Error processing message: " + std::string(Except.what()));
+			}
+		});
+}
+
+MCP_NAMESPACE_END
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <thread>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/IO/IOReactor.h"
+#include "Utilities/IO/LineFramer.h"
+#include "Utilities/IO/NativeHandle.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Event-driven reader for newline-delimited JSON-RPC over a raw pipe or standard stream.
+ * Without a reactor, a dedicated reader thread blocks in poll() until data or a stop request arrives. With one, the
+ * handle is switched to non-blocking mode and serviced by the reactor's loop threads, so any number of readers share
+ * a handful of threads. Either way whatever is available is read into a LineFramer and every complete line is handed
+ * to the frame callback as a view into the framer's buffer.
+ */
+class StdioReader
+{
+public:
+	using FrameCallback = std::function<void(std::string_view)>;
+	using CloseCallback = std::function<void()>;
+
+	// Reads serviced per reactor wakeup, so one busy handle cannot starve the rest of its loop
+	static constexpr int MAX_READS_PER_WAKEUP{ 4 };
+
+	/**
+	 * @param InHandle The handle to read from. Ownership stays with the caller.
+	 * @param InOnFrame Invoked on the reader thread for every complete line
+	 * @param InOnClose Invoked on the reader thread once the peer closes its end
+	 * @param InReactor Reactor to service the handle on, or null for a dedicated thread. Ignored where the reactor
+	 * is not supported.
+	 */
+	StdioReader(NativeHandle InHandle,
+		FrameCallback InOnFrame,
+		CloseCallback InOnClose = {},
+		IOReactor* InReactor = nullptr);
+	~StdioReader() noexcept;
+	StdioReader(const StdioReader&) = delete;
+	StdioReader(StdioReader&&) = delete;
+	StdioReader& operator=(const StdioReader&) = delete;
+	StdioReader& operator=(StdioReader&&) = delete;
+
+	void Start();
+	/**
+	 * Stop reading. From any other thread this waits for the reader to exit. From inside a frame or close callback
+	 * it only stops further delivery and returns at once; the loop winds down on its own and the owner may be
+	 * destroyed before it has, since the loop keeps its state alive by itself.
+	 */
+	void Stop();
+	[[nodiscard]] bool IsRunning() const { return m_State->IsRunning; }
+
+private:
+	// Everything the read loop touches, shared with it so a reader destroyed from its own callback stays valid
+	struct State
+	{
+		State(NativeHandle InHandle, FrameCallback InOnFrame, CloseCallback InOnClose, IOReactor* InReactor);
+		~State() noexcept;
+		State(const State&) = delete;
+		State(State&&) = delete;
+		State& operator=(const State&) = delete;
+		State& operator=(State&&) = delete;
+
+		NativeHandle Handle;
+		FrameCallback OnFrame;
+		CloseCallback OnClose;
+		IOReactor* Reactor;
+		LineFramer Framer;
+		std::atomic<bool> IsRunning{ false };
+		std::atomic<bool> IsStopping{ false };
+
+#if !defined(_WIN32)
+		// Self-pipe used to wake the poll() in ReadLoop on Stop()
+		int WakeRead{ -1 };
+		int WakeWrite{ -1 };
+#endif
+	};
+
+	static void ReadLoop(const std::shared_ptr<State>& InState);
+	static void OnReadable(State& InState);
+	static void DeliverFrames(State& InState, std::size_t InCount);
+	[[nodiscard]] bool IsReaderThread() const { return m_Thread.get_id() == std::this_thread::get_id(); }
+
+	std::shared_ptr<State> m_State;
+	std::jthread m_Thread;
+};
+
+MCP_NAMESPACE_END
@@ -1,5 +1,10 @@
 #include "JSONMessages.h"
 
+#include <charconv>
+#include <system_error>
+
+#include "Utilities/JSON/JSONReader.h"
+
 MCP_NAMESPACE_BEGIN
 
 std::optional<JSONData> ParseJSONMessage(const std::string& InRawMessage)
@@ -14,13 +19,13 @@ std::optional<JSONData> ParseJSONMessage(const std::string& InRawMessage)
 	}
 }
 
-std::string ExtractMethod(const JSONData& InMessage)
+std::string_view ExtractMethod(const JSONData& InMessage)
 {
-	if (InMessage.contains("method") && InMessage["method"].is_string())
+	if (const auto Iter = InMessage.find("method"); Iter != InMessage.end() && Iter->is_string())
 	{
-		return InMessage["method"].get<std::string>();
+		return Iter->get_ref<const std::string&>();
 	}
-	return "";
+	return {};
 }
 
 std::optional<RequestID> ExtractRequestID(const JSONData& InMessage)
@@ -109,4 +114,146 @@ std::optional<EMessageType> GetValidMessageType(const JSONData& InMessage)
 	return std::nullopt;
 }
 
-MCP_NAMESPACE_END
\ No newline at end of file
+MessageEnvelope ScanEnvelope(const std::string_view InText)
+{
+	MessageEnvelope Envelope;
+
+	JSONReader Reader(InText);
+	if (Reader.Peek() != JSONReader::EValueType::Object)
+	{
+		return Envelope;
+	}
+
+	bool HasVersion{ false };
+	bool HasID{ false };
+	bool HasMethod{ false };
+	bool HasResult{ false };
+	bool HasError{ false };
+
+	Reader.BeginObject();
+	while (const std::optional<std::string_view> Key = Reader.NextKey())
+	{
+		const JSONReader::EValueType ValueType = Reader.Peek();
+		if (Key.value() == "jsonrpc" && ValueType == JSONReader::EValueType::String)
+		{
+			Envelope.IsJSONRPC2 = Reader.ReadString() == "2.0";
+		}
+		else if (Key.value() == "id" && ValueType == JSONReader::EValueType::String)
+		{
+			Envelope.ID = RequestID{ Reader.ReadString() };
+		}
+		else if (Key.value() == "id" && ValueType == JSONReader::EValueType::Number)
+		{
+			// Only an exact integer can be an ID issued by AllocateRequestID
+			const std::string_view Number = Reader.ReadRaw();
+			if (int64_t Value{ 0 }; std::from_chars(Number.data(), Number.data() + Number.size(), Value).ptr
+				== Number.data() + Number.size())
+			{
+				Envelope.ID = RequestID{ Value };
+			}
+		}
+		else if (Key.value() == "method" && ValueType == JSONReader::EValueType::String)
+		{
+			Envelope.Method = Reader.ReadString();
+		}
+		else if (Key.value() != "result" && Key.value() != "error")
+		{
+			Reader.Skip();
+		}
+
+		HasVersion |= Key.value() == "jsonrpc";
+		HasID |= Key.value() == "id";
+		HasMethod |= Key.value() == "method";
+		HasResult |= Key.value() == "result";
+		HasError |= Key.value() == "error";
+
+		// The payload is left unread once the envelope is known
+		if (HasVersion && HasID && (HasMethod || HasResult || HasError))
+		{
+			break;
+		}
+		if (Key.value() == "result" || Key.value() == "error")
+		{
+			Reader.Skip();
+		}
+	}
+
+	if (HasID && HasMethod)
+	{
+		Envelope.Type = EMessageType::Request;
+	}
+	else if (HasID && HasError)
+	{
+		Envelope.Type = EMessageType::Error;
+	}
+	else if (HasID && HasResult)
+	{
+		Envelope.Type = EMessageType::Response;
+	}
+	else if (HasMethod && !HasID)
+	{
+		Envelope.Type = EMessageType::Notification;
+	}
+	return Envelope;
+}
+
+std::optional<std::string_view> GetMessageText(const InboundMessage& InMessage)
+{
+	if (const std::string* Text = std::get_if<std::string>(&InMessage))
+	{
+		return *Text;
+	}
+	if (const std::string_view* Text = std::get_if<std::string_view>(&InMessage))
+	{
+		return *Text;
+	}
+	return std::nullopt;
+}
+
+MessageEnvelope GetEnvelope(const InboundMessage& InMessage)
+{
+	if (const std::optional<std::string_view> Text = GetMessageText(InMessage))
+	{
+		return ScanEnvelope(*Text);
+	}
+
+	MessageEnvelope Envelope;
+	const JSONData& Message = std::get<JSONData>(InMessage);
+	if (!Message.is_object())
+	{
+		return Envelope;
+	}
+
+	Envelope.Type = GetValidMessageType(Message);
+	Envelope.IsJSONRPC2 = Message.value("jsonrpc", "") == "2.0";
+	Envelope.Method = ExtractMethod(Message);
+	if (const auto ID = Message.find("id"); ID != Message.end())
+	{
+		if (ID->is_string())
+		{
+			Envelope.ID = RequestID{ ID->get<std::string>() };
+		}
+		else if (ID->is_number_integer())
+		{
+			Envelope.ID = RequestID{ ID->get<int64_t>() };
+		}
+	}
+	return Envelope;
+}
+
+bool IsBatchText(const std::string_view InText)
+{
+	const std::size_t First = InText.find_first_not_of(" \t\r\n");
+	return First != std::string_view::npos && InText[First] == '[';
+}
+
+bool IsBatch(const InboundMessage& InMessage)
+{
+	if (const std::optional<std::string_view> Text = GetMessageText(InMessage))
+	{
+		return IsBatchText(*Text);
+	}
+	return std::get<JSONData>(InMessage).is_array();
+}
+
+MCP_NAMESPACE_END
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
 #include "CoreSDK/Common/Macros.h"
 #include "CoreSDK/Messages/RequestBase.h"
 #include "JSONProxy.h"
@@ -8,8 +13,47 @@ MCP_NAMESPACE_BEGIN
 
 enum class EMessageType { Request, Response, Error, Notification };
 
+/**
+ * What routing needs to know about a message, read from its text without decoding the rest. Type follows the same
+ * rules as GetValidMessageType and is empty for anything that is not a JSON-RPC message.
+ */
+struct MessageEnvelope
+{
+	std::optional<EMessageType> Type{ std::nullopt };
+	bool IsJSONRPC2{ false };
+	// Empty if there is no method or it is not a string
+	std::string Method;
+	// Empty if there is no id or it is neither an integer nor a string
+	std::optional<RequestID> ID{ std::nullopt };
+
+	[[nodiscard]] bool IsValid() const { return IsJSONRPC2 && Type.has_value(); }
+};
+
+/**
+ * A message or batch as received: JSON text, or the document a binary frame was decoded into. Text can also be
+ * borrowed from the reader's buffer, in which case it is only valid until the router returns; whatever keeps the
+ * message past that point has to take its own copy.
+ */
+using InboundMessage = std::variant<std::string, JSONData, std::string_view>;
+
+/**
+ * Scan the envelope of a single message. Reading stops as soon as jsonrpc, id and one of method, result or error
+ * have been seen, so params and results that follow them are never touched; only a notification, which has to be
+ * read to its end to rule out an id, is stepped over in full. Throws JSONData::parse_error for malformed text in
+ * the part that is read; the rest is checked when a handler decodes the message.
+ */
+[[nodiscard]] MessageEnvelope ScanEnvelope(std::string_view InText);
+// The text of an inbound message, owned or borrowed; empty for a document
+[[nodiscard]] std::optional<std::string_view> GetMessageText(const InboundMessage& InMessage);
+// The envelope of an inbound message: text is scanned, a document is looked up
+[[nodiscard]] MessageEnvelope GetEnvelope(const InboundMessage& InMessage);
+// Whether the text is a batch, judged by its first character
+[[nodiscard]] bool IsBatchText(std::string_view InText);
+[[nodiscard]] bool IsBatch(const InboundMessage& InMessage);
+
 [[nodiscard]] std::optional<JSONData> ParseJSONMessage(const std::string& InRawMessage);
-[[nodiscard]] std::string ExtractMethod(const JSONData& InMessage);
+// Views the method inside InMessage; empty if there is none
+[[nodiscard]] std::string_view ExtractMethod(const JSONData& InMessage);
 [[nodiscard]] std::optional<RequestID> ExtractRequestID(const JSONData& InMessage);
 [[nodiscard]] JSONData ExtractParams(const JSONData& InMessage);
 [[nodiscard]] JSONData ExtractResult(const JSONData& InMessage);
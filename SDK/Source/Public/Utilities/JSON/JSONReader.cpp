@@ -0,0 +1,455 @@
+#include "Utilities/JSON/JSONReader.h"
+
+#include <bitset>
+#include <charconv>
+#include <system_error>
+
+MCP_NAMESPACE_BEGIN
+
+JSONReader::EValueType JSONReader::Peek()
+{
+	switch (PeekChar())
+	{
+		case 'n':
+			return EValueType::Null;
+		case 't':
+		case 'f':
+			return EValueType::Boolean;
+		case '"':
+			return EValueType::String;
+		case '{':
+			return EValueType::Object;
+		case '[':
+			return EValueType::Array;
+		case '-':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			return EValueType::Number;
+		default:
+			Fail("unexpected character");
+	}
+}
+
+void JSONReader::ReadNull() { ExpectLiteral("null"); }
+
+bool JSONReader::ReadBoolean()
+{
+	if (PeekChar() == 't')
+	{
+		ExpectLiteral("true");
+		return true;
+	}
+	ExpectLiteral("false");
+	return false;
+}
+
+int64_t JSONReader::ReadInteger()
+{
+	const std::string_view Number = ReadNumberText();
+	int64_t Value{ 0 };
+	if (const auto [End, Error] = std::from_chars(Number.data(), Number.data() + Number.size(), Value);
+		Error == std::errc{} && End == Number.data() + Number.size())
+	{
+		return Value;
+	}
+
+	// Like JSONData, accept a number written with a fraction or exponent and truncate it
+	double Fallback{ 0.0 };
+	if (const auto [End, Error] = std::from_chars(Number.data(), Number.data() + Number.size(), Fallback);
+		Error != std::errc{} || End != Number.data() + Number.size())
+	{
+		Fail("expected an integer");
+	}
+	return static_cast<int64_t>(Fallback);
+}
+
+uint64_t JSONReader::ReadUnsigned()
+{
+	const std::string_view Number = ReadNumberText();
+	uint64_t Value{ 0 };
+	if (const auto [End, Error] = std::from_chars(Number.data(), Number.data() + Number.size(), Value);
+		Error == std::errc{} && End == Number.data() + Number.size())
+	{
+		return Value;
+	}
+
+	// Like JSONData, accept a number written with a fraction or exponent and truncate it
+	double Fallback{ 0.0 };
+	if (const auto [End, Error] = std::from_chars(Number.data(), Number.data() + Number.size(), Fallback);
+		Error != std::errc{} || End != Number.data() + Number.size())
+	{
+		Fail("expected an unsigned integer");
+	}
+	return static_cast<uint64_t>(Fallback);
+}
+
+double JSONReader::ReadDouble()
+{
+	const std::string_view Number = ReadNumberText();
+	double Value{ 0.0 };
+	if (const auto [End, Error] = std::from_chars(Number.data(), Number.data() + Number.size(), Value);
+		Error != std::errc{} || End != Number.data() + Number.size())
+	{
+		Fail("expected a number");
+	}
+	return Value;
+}
+
+std::string JSONReader::ReadString()
+{
+	std::string Value;
+	if (const std::optional<std::string_view> Plain = ReadStringInto(Value))
+	{
+		Value.assign(Plain.value());
+	}
+	return Value;
+}
+
+void JSONReader::BeginObject()
+{
+	Expect('{');
+	m_IsFirstMember = true;
+}
+
+std::optional<std::string_view> JSONReader::NextKey()
+{
+	const char Next = PeekChar();
+	if (Next == '}')
+	{
+		++m_Position;
+		m_IsFirstMember = false;
+		return std::nullopt;
+	}
+	if (!m_IsFirstMember)
+	{
+		Expect(',');
+	}
+	m_IsFirstMember = false;
+
+	m_KeyBuffer.clear();
+	const std::optional<std::string_view> Plain = ReadStringInto(m_KeyBuffer);
+	Expect(':');
+	return Plain ? Plain.value() : std::string_view{ m_KeyBuffer };
+}
+
+void JSONReader::BeginArray()
+{
+	Expect('[');
+	m_IsFirstMember = true;
+}
+
+bool JSONReader::NextElement()
+{
+	if (PeekChar() == ']')
+	{
+		++m_Position;
+		m_IsFirstMember = false;
+		return false;
+	}
+	if (!m_IsFirstMember)
+	{
+		Expect(',');
+	}
+	m_IsFirstMember = false;
+	return true;
+}
+
+void JSONReader::Skip()
+{
+	// Walked with a stack of its own rather than by recursion, so nesting in untrusted text cannot exhaust the
+	// thread's stack. A set bit marks an open array, a clear one an open object.
+	std::bitset<MAX_DEPTH> IsArray;
+	std::size_t Depth{ 0 };
+	do
+	{
+		if (Depth > 0 && !(IsArray[Depth - 1] ? NextElement() : NextKey().has_value()))
+		{
+			--Depth;
+			continue;
+		}
+
+		switch (Peek())
+		{
+			case EValueType::Null:
+				ReadNull();
+				break;
+			case EValueType::Boolean:
+				(void)ReadBoolean();
+				break;
+			case EValueType::Number:
+				(void)ReadNumberText();
+				break;
+			case EValueType::String:
+			{
+				// Not the key buffer: the caller may still hold the key this value belongs to
+				std::string Discarded;
+				(void)ReadStringInto(Discarded);
+				break;
+			}
+			case EValueType::Object:
+			case EValueType::Array:
+			{
+				if (Depth == MAX_DEPTH)
+				{
+					Fail("nesting too deep");
+				}
+				IsArray[Depth] = PeekChar() == '[';
+				if (IsArray[Depth])
+				{
+					BeginArray();
+				}
+				else
+				{
+					BeginObject();
+				}
+				++Depth;
+				break;
+			}
+		}
+	} while (Depth > 0);
+}
+
+std::string_view JSONReader::ReadRaw()
+{
+	SkipWhitespace();
+	const std::size_t Start = m_Position;
+	Skip();
+	return m_Text.substr(Start, m_Position - Start);
+}
+
+JSONData JSONReader::ReadValue()
+{
+	const std::string_view Raw = ReadRaw();
+	return JSONData::parse(Raw.begin(), Raw.end());
+}
+
+void JSONReader::ExpectEnd()
+{
+	SkipWhitespace();
+	if (m_Position != m_Text.size())
+	{
+		Fail("unexpected trailing characters");
+	}
+}
+
+void JSONReader::SkipWhitespace()
+{
+	while (m_Position < m_Text.size())
+	{
+		const char Character = m_Text[m_Position];
+		if (Character != ' ' && Character != '\t' && Character != '\n' && Character != '\r')
+		{
+			return;
+		}
+		++m_Position;
+	}
+}
+
+char JSONReader::PeekChar()
+{
+	SkipWhitespace();
+	if (m_Position >= m_Text.size())
+	{
+		Fail("unexpected end of input");
+	}
+	return m_Text[m_Position];
+}
+
+void JSONReader::Expect(const char InCharacter)
+{
+	if (PeekChar() != InCharacter)
+	{
+		Fail(std::string("expected '") + InCharacter + "'");
+	}
+	++m_Position;
+}
+
+void JSONReader::ExpectLiteral(const std::string_view InLiteral)
+{
+	SkipWhitespace();
+	if (m_Text.substr(m_Position, InLiteral.size()) != InLiteral)
+	{
+		Fail("expected '" + std::string(InLiteral) + "'");
+	}
+	m_Position += InLiteral.size();
+}
+
+std::string_view JSONReader::ReadNumberText()
+{
+	SkipWhitespace();
+	const std::size_t Start = m_Position;
+	while (m_Position < m_Text.size())
+	{
+		const char Character = m_Text[m_Position];
+		if ((Character < '0' || Character > '9') && Character != '-' && Character != '+' && Character != '.'
+			&& Character != 'e' && Character != 'E')
+		{
+			break;
+		}
+		++m_Position;
+	}
+	if (m_Position == Start)
+	{
+		Fail("expected a number");
+	}
+	return m_Text.substr(Start, m_Position - Start);
+}
+
+std::optional<std::string_view> JSONReader::ReadStringInto(std::string& OutValue)
+{
+	Expect('"');
+
+	// Most strings carry no escapes and can be handed back as a view of the text
+	const std::size_t Start = m_Position;
+	while (m_Position < m_Text.size() && m_Text[m_Position] != '"' && m_Text[m_Position] != '\\')
+	{
+		if (static_cast<unsigned char>(m_Text[m_Position]) < 0x20)
+		{
+			Fail("control character in string");
+		}
+		++m_Position;
+	}
+	if (m_Position >= m_Text.size())
+	{
+		Fail("unterminated string");
+	}
+	if (m_Text[m_Position] == '"')
+	{
+		return m_Text.substr(Start, m_Position++ - Start);
+	}
+
+	OutValue.append(m_Text.substr(Start, m_Position - Start));
+	while (true)
+	{
+		if (m_Position >= m_Text.size())
+		{
+			Fail("unterminated string");
+		}
+
+		const char Character = m_Text[m_Position++];
+		if (Character == '"')
+		{
+			return std::nullopt;
+		}
+		if (Character == '\\')
+		{
+			AppendEscape(OutValue);
+		}
+		else if (static_cast<unsigned char>(Character) < 0x20)
+		{
+			Fail("control character in string");
+		}
+		else
+		{
+			OutValue.push_back(Character);
+		}
+	}
+}
+
+void JSONReader::AppendEscape(std::string& OutValue)
+{
+	if (m_Position >= m_Text.size())
+	{
+		Fail("unterminated escape");
+	}
+
+	switch (const char Escape = m_Text[m_Position++])
+	{
+		case '"':
+		case '\\':
+		case '/':
+			OutValue.push_back(Escape);
+			return;
+		case 'b':
+			OutValue.push_back('\b');
+			return;
+		case 'f':
+			OutValue.push_back('\f');
+			return;
+		case 'n':
+			OutValue.push_back('\n');
+			return;
+		case 'r':
+			OutValue.push_back('\r');
+			return;
+		case 't':
+			OutValue.push_back('\t');
+			return;
+		case 'u':
+			break;
+		default:
+			Fail("invalid escape");
+	}
+
+	const auto ReadCodeUnit = [this]
+	{
+		uint32_t Value{ 0 };
+		const std::string_view Digits = m_Text.substr(m_Position, 4);
+		if (const auto [End, Error] = std::from_chars(Digits.data(), Digits.data() + Digits.size(), Value, 16);
+			Digits.size() != 4 || Error != std::errc{} || End != Digits.data() + 4)
+		{
+			Fail("invalid unicode escape");
+		}
+		m_Position += 4;
+		return Value;
+	};
+
+	uint32_t CodePoint = ReadCodeUnit();
+	if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+	{
+		if (m_Text.substr(m_Position, 2) != "\\u")
+		{
+			Fail("unpaired surrogate");
+		}
+		m_Position += 2;
+		const uint32_t Low = ReadCodeUnit();
+		if (Low < 0xDC00 || Low > 0xDFFF)
+		{
+			Fail("unpaired surrogate");
+		}
+		CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+	}
+	else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+	{
+		Fail("unpaired surrogate");
+	}
+
+	// UTF-8 encode
+	if (CodePoint < 0x80)
+	{
+		OutValue.push_back(static_cast<char>(CodePoint));
+	}
+	else if (CodePoint < 0x800)
+	{
+		OutValue.push_back(static_cast<char>(0xC0 | (CodePoint >> 6)));
+		OutValue.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+	}
+	else if (CodePoint < 0x10000)
+	{
+		OutValue.push_back(static_cast<char>(0xE0 | (CodePoint >> 12)));
+		OutValue.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		OutValue.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+	}
+	else
+	{
+		OutValue.push_back(static_cast<char>(0xF0 | (CodePoint >> 18)));
+		OutValue.push_back(static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F)));
+		OutValue.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		OutValue.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+	}
+}
+
+void JSONReader::Fail(const std::string& InMessage) const
+{
+	throw JSONData::parse_error::create(101, m_Position, "syntax error while reading JSON: " + InMessage, nullptr);
+}
+
+MCP_NAMESPACE_END
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "JSONProxy.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Pull parser over JSON text. Values are read straight into their destination as the text is walked, so decoding a
+ * message never builds a document for it; only ReadValue materializes a JSONData, for free-form fields.
+ * Malformed input throws JSONData::parse_error and a missing required key JSONData::out_of_range, the same as
+ * JSONData::parse() followed by from_json.
+ */
+class JSONReader
+{
+public:
+	enum class EValueType : uint8_t
+	{
+		Null,
+		Boolean,
+		Number,
+		String,
+		Object,
+		Array
+	};
+
+	// Objects and arrays nested deeper than this within one value are rejected as malformed
+	static constexpr std::size_t MAX_DEPTH{ 512 };
+
+	explicit JSONReader(std::string_view InText) : m_Text(InText) {}
+
+	// Type of the next value, without consuming it
+	[[nodiscard]] EValueType Peek();
+
+	void ReadNull();
+	[[nodiscard]] bool ReadBoolean();
+	[[nodiscard]] int64_t ReadInteger();
+	[[nodiscard]] uint64_t ReadUnsigned();
+	[[nodiscard]] double ReadDouble();
+	[[nodiscard]] std::string ReadString();
+
+	void BeginObject();
+	/**
+	 * Advance to the next member of the current object and return its key, or nullopt once the object is closed.
+	 * The view points into the text, or into an internal buffer when the key contains escapes, and stays valid until
+	 * the next call.
+	 */
+	[[nodiscard]] std::optional<std::string_view> NextKey();
+
+	void BeginArray();
+	// Advance to the next element of the current array; false once the array is closed
+	[[nodiscard]] bool NextElement();
+
+	// Step over the next value without decoding it
+	void Skip();
+	// The exact text of the next value, which is consumed
+	[[nodiscard]] std::string_view ReadRaw();
+	// Build a document for the next value only
+	[[nodiscard]] JSONData ReadValue();
+
+	// Fails unless only whitespace is left
+	void ExpectEnd();
+
+	[[nodiscard]] std::size_t GetPosition() const { return m_Position; }
+
+private:
+	void SkipWhitespace();
+	[[nodiscard]] char PeekChar();
+	void Expect(char InCharacter);
+	void ExpectLiteral(std::string_view InLiteral);
+	[[nodiscard]] std::string_view ReadNumberText();
+	// Appends the decoded string to OutValue; returns a view into the text instead when there is nothing to decode
+	[[nodiscard]] std::optional<std::string_view> ReadStringInto(std::string& OutValue);
+	void AppendEscape(std::string& OutValue);
+	[[noreturn]] void Fail(const std::string& InMessage) const;
+
+	std::string_view m_Text;
+	std::size_t m_Position{ 0 };
+	// Whether the object or array being iterated still expects its first member
+	bool m_IsFirstMember{ false };
+	std::string m_KeyBuffer;
+};
+
+template <typename T> void ReadJSON(JSONReader& InReader, T& OutValue);
+
+namespace JSONReaderDetail
+{
+	template <typename T> struct IsVector : std::false_type
+	{};
+	template <typename T, typename Alloc> struct IsVector<std::vector<T, Alloc>> : std::true_type
+	{};
+
+	template <typename T> struct IsStringMap : std::false_type
+	{};
+	template <typename T> struct IsStringMap<std::unordered_map<std::string, T>> : std::true_type
+	{};
+	template <typename T> struct IsStringMap<std::map<std::string, T>> : std::true_type
+	{};
+
+	template <typename T> struct IsUniquePtr : std::false_type
+	{};
+	template <typename T> struct IsUniquePtr<std::unique_ptr<T>> : std::true_type
+	{};
+
+	// One pass over the members, each dispatched to the JSON_KEY it names; unknown members are skipped
+	template <HasJSONKeys T> void ReadKeyedObject(JSONReader& InReader, T& OutValue)
+	{
+		static constexpr auto Keys = T::JSONKeys();
+		constexpr std::size_t KeyCount = std::tuple_size_v<std::remove_const_t<decltype(Keys)>>;
+		static_assert(KeyCount <= 64, "Too many JSON keys for one type");
+
+		uint64_t Seen{ 0 };
+		InReader.BeginObject();
+		while (const std::optional<std::string_view> Key = InReader.NextKey())
+		{
+			const bool Matched = std::apply(
+				[&](const auto&... InKeys)
+				{
+					std::size_t Index{ 0 };
+					return ((InKeys.json_key == Key.value()
+								 ? (InKeys.read_json(InReader, OutValue), Seen |= uint64_t{ 1 } << Index, true)
+								 : (++Index, false))
+						|| ...);
+				},
+				Keys);
+			if (!Matched)
+			{
+				InReader.Skip();
+			}
+		}
+
+		std::apply(
+			[&](const auto&... InKeys)
+			{
+				std::size_t Index{ 0 };
+				(
+					[&]
+					{
+						if (InKeys.is_required(OutValue) && (Seen & (uint64_t{ 1 } << Index)) == 0)
+						{
+							throw JSONData::out_of_range::create(403,
+								"key '" + std::string(InKeys.json_key) + "' not found",
+								nullptr);
+						}
+						++Index;
+					}(),
+					...);
+			},
+			Keys);
+	}
+} // namespace JSONReaderDetail
+
+/**
+ * Decode the next value into OutValue. Types declared with DEFINE_TYPE_JSON are filled field by field from their
+ * JSON_KEYs; JSONData fields receive a document of just their subtree; anything else with a from_json, such as
+ * variants or RequestID, is decoded from a document of its own value.
+ */
+template <typename T> void ReadJSON(JSONReader& InReader, T& OutValue)
+{
+	using namespace JSONReaderDetail;
+
+	if constexpr (std::is_same_v<T, JSONData>)
+	{
+		OutValue = InReader.ReadValue();
+	}
+	else if constexpr (std::is_same_v<T, bool>)
+	{
+		OutValue = InReader.ReadBoolean();
+	}
+	else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+	{
+		OutValue = static_cast<T>(InReader.ReadInteger());
+	}
+	else if constexpr (std::is_integral_v<T>)
+	{
+		OutValue = static_cast<T>(InReader.ReadUnsigned());
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		OutValue = static_cast<T>(InReader.ReadDouble());
+	}
+	else if constexpr (std::is_class_v<T> && std::is_convertible_v<T, double> && std::is_assignable_v<T&, double>)
+	{
+		// Numeric wrappers such as BoundedDouble, which clamp on assignment
+		OutValue = InReader.ReadDouble();
+	}
+	else if constexpr (std::is_same_v<T, std::string>)
+	{
+		OutValue = InReader.ReadString();
+	}
+	else if constexpr (IsOptional<T>)
+	{
+		if (InReader.Peek() == JSONReader::EValueType::Null)
+		{
+			InReader.ReadNull();
+			OutValue.reset();
+		}
+		else
+		{
+			ReadJSON(InReader, OutValue.emplace());
+		}
+	}
+	else if constexpr (IsUniquePtr<T>::value)
+	{
+		if (InReader.Peek() == JSONReader::EValueType::Null)
+		{
+			InReader.ReadNull();
+			OutValue.reset();
+		}
+		else
+		{
+			OutValue = std::make_unique<typename T::element_type>();
+			ReadJSON(InReader, *OutValue);
+		}
+	}
+	else if constexpr (IsVector<T>::value)
+	{
+		OutValue.clear();
+		InReader.BeginArray();
+		while (InReader.NextElement())
+		{
+			ReadJSON(InReader, OutValue.emplace_back());
+		}
+	}
+	else if constexpr (IsStringMap<T>::value)
+	{
+		OutValue.clear();
+		InReader.BeginObject();
+		while (const std::optional<std::string_view> Key = InReader.NextKey())
+		{
+			ReadJSON(InReader, OutValue[std::string(Key.value())]);
+		}
+	}
+	else if constexpr (HasJSONKeys<T>)
+	{
+		ReadKeyedObject(InReader, OutValue);
+	}
+	else
+	{
+		InReader.ReadValue().get_to(OutValue);
+	}
+}
+
+// Decode a whole document into OutValue
+template <typename T> void DecodeJSON(const std::string_view InText, T& OutValue)
+{
+	JSONReader Reader(InText);
+	ReadJSON(Reader, OutValue);
+	Reader.ExpectEnd();
+}
+
+MCP_NAMESPACE_END
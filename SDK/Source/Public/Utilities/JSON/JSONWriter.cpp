@@ -0,0 +1,235 @@
+#include "Utilities/JSON/JSONWriter.h"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+MCP_NAMESPACE_BEGIN
+
+namespace
+{
+	// Length of the UTF-8 sequence starting at InText[InIndex], or zero if it is malformed
+	std::size_t ValidSequenceLength(const std::string_view InText, const std::size_t InIndex)
+	{
+		const auto Byte = [&InText](const std::size_t InAt) { return static_cast<unsigned char>(InText[InAt]); };
+		const auto IsContinuation
+			= [&](const std::size_t InAt) { return InAt < InText.size() && (Byte(InAt) & 0xC0) == 0x80; };
+
+		const unsigned char Lead = Byte(InIndex);
+		if (Lead >= 0xC2 && Lead <= 0xDF)
+		{
+			return IsContinuation(InIndex + 1) ? 2 : 0;
+		}
+		if (Lead >= 0xE0 && Lead <= 0xEF)
+		{
+			if (!IsContinuation(InIndex + 1) || !IsContinuation(InIndex + 2))
+			{
+				return 0;
+			}
+			// No overlong forms and no surrogates
+			const unsigned char Second = Byte(InIndex + 1);
+			if ((Lead == 0xE0 && Second < 0xA0) || (Lead == 0xED && Second > 0x9F))
+			{
+				return 0;
+			}
+			return 3;
+		}
+		if (Lead >= 0xF0 && Lead <= 0xF4)
+		{
+			if (!IsContinuation(InIndex + 1) || !IsContinuation(InIndex + 2) || !IsContinuation(InIndex + 3))
+			{
+				return 0;
+			}
+			// No overlong forms and nothing past U+10FFFF
+			const unsigned char Second = Byte(InIndex + 1);
+			if ((Lead == 0xF0 && Second < 0x90) || (Lead == 0xF4 && Second > 0x8F))
+			{
+				return 0;
+			}
+			return 4;
+		}
+		return 0;
+	}
+} // namespace
+
+void JSONWriter::WriteNull()
+{
+	BeginValue();
+	m_Buffer.append("null");
+}
+
+void JSONWriter::WriteBoolean(const bool InValue)
+{
+	BeginValue();
+	m_Buffer.append(InValue ? "true" : "false");
+}
+
+void JSONWriter::WriteInteger(const int64_t InValue)
+{
+	BeginValue();
+	std::array<char, 24> Digits{};
+	const auto [End, Error] = std::to_chars(Digits.data(), Digits.data() + Digits.size(), InValue);
+	m_Buffer.append(Digits.data(), End);
+}
+
+void JSONWriter::WriteUnsigned(const uint64_t InValue)
+{
+	BeginValue();
+	std::array<char, 24> Digits{};
+	const auto [End, Error] = std::to_chars(Digits.data(), Digits.data() + Digits.size(), InValue);
+	m_Buffer.append(Digits.data(), End);
+}
+
+void JSONWriter::WriteDouble(const double InValue)
+{
+	BeginValue();
+
+	// Like JSONData, NaN and infinity have no JSON form and are written as null
+	if (!std::isfinite(InValue))
+	{
+		m_Buffer.append("null");
+		return;
+	}
+
+	std::array<char, 32> Digits{};
+	const auto [End, Error] = std::to_chars(Digits.data(), Digits.data() + Digits.size(), InValue);
+	const std::string_view Number(Digits.data(), static_cast<std::size_t>(End - Digits.data()));
+	m_Buffer.append(Number);
+
+	// Keep a whole number recognizable as floating point, as JSONData does
+	if (Number.find_first_of(".eE") == std::string_view::npos)
+	{
+		m_Buffer.append(".0");
+	}
+}
+
+void JSONWriter::WriteString(const std::string_view InValue)
+{
+	BeginValue();
+	AppendEscaped(InValue);
+}
+
+void JSONWriter::BeginObject()
+{
+	BeginValue();
+	m_Buffer.push_back('{');
+	m_NeedsComma = false;
+}
+
+void JSONWriter::Key(const std::string_view InKey)
+{
+	BeginValue();
+	AppendEscaped(InKey);
+	m_Buffer.push_back(':');
+	m_NeedsComma = false;
+}
+
+void JSONWriter::EndObject()
+{
+	m_Buffer.push_back('}');
+	m_NeedsComma = true;
+}
+
+void JSONWriter::BeginArray()
+{
+	BeginValue();
+	m_Buffer.push_back('[');
+	m_NeedsComma = false;
+}
+
+void JSONWriter::EndArray()
+{
+	m_Buffer.push_back(']');
+	m_NeedsComma = true;
+}
+
+void JSONWriter::WriteRaw(const std::string_view InJSON)
+{
+	BeginValue();
+	m_Buffer.append(InJSON);
+}
+
+void JSONWriter::WriteValue(const JSONData& InValue)
+{
+	BeginValue();
+	nlohmann::detail::serializer<JSONData> Serializer(nlohmann::detail::output_adapter<char>(m_Buffer), ' ');
+	Serializer.dump(InValue, false, false, 0);
+}
+
+void JSONWriter::BeginValue()
+{
+	if (m_NeedsComma)
+	{
+		m_Buffer.push_back(',');
+	}
+	m_NeedsComma = true;
+}
+
+void JSONWriter::AppendEscaped(const std::string_view InValue)
+{
+	static constexpr std::string_view HEX_DIGITS{ "0123456789abcdef" };
+
+	m_Buffer.push_back('"');
+
+	// Runs of characters that need no escaping are copied in one go
+	std::size_t RunStart{ 0 };
+	std::size_t Index{ 0 };
+	while (Index < InValue.size())
+	{
+		const auto Character = static_cast<unsigned char>(InValue[Index]);
+		if (Character >= 0x80)
+		{
+			const std::size_t Length = ValidSequenceLength(InValue, Index);
+			if (Length == 0)
+			{
+				throw JSONData::type_error::create(316,
+					"invalid UTF-8 byte at index " + std::to_string(Index),
+					nullptr);
+			}
+			Index += Length;
+			continue;
+		}
+		if (Character >= 0x20 && Character != '"' && Character != '\\')
+		{
+			++Index;
+			continue;
+		}
+
+		m_Buffer.append(InValue.substr(RunStart, Index - RunStart));
+		switch (Character)
+		{
+			case '"':
+				m_Buffer.append("\\\"");
+				break;
+			case '\\':
+				m_Buffer.append("\\\\");
+				break;
+			case '\b':
+				m_Buffer.append("\\b");
+				break;
+			case '\f':
+				m_Buffer.append("\\f");
+				break;
+			case '\n':
+				m_Buffer.append("\\n");
+				break;
+			case '\r':
+				m_Buffer.append("\\r");
+				break;
+			case '\t':
+				m_Buffer.append("\\t");
+				break;
+			default:
+				m_Buffer.append("\\u00");
+				m_Buffer.push_back(HEX_DIGITS[Character >> 4]);
+				m_Buffer.push_back(HEX_DIGITS[Character & 0x0F]);
+				break;
+		}
+		RunStart = ++Index;
+	}
+	m_Buffer.append(InValue.substr(RunStart));
+
+	m_Buffer.push_back('"');
+}
+
+MCP_NAMESPACE_END
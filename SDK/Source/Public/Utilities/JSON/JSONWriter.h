@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "CoreSDK/Common/Macros.h"
+#include "JSONProxy.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Streaming JSON serializer that appends to a caller-owned buffer. Values are written as they are visited, so
+ * encoding a message never builds a document for it; only free-form JSONData fields are dumped from their own
+ * document. The output is equivalent to JSONData::dump(), with members in declaration order, and strings that are
+ * not valid UTF-8 are rejected the same way.
+ * The buffer is only appended to, so a transport can write its framing prefix first and its suffix after.
+ */
+class JSONWriter
+{
+public:
+	explicit JSONWriter(std::string& OutBuffer) : m_Buffer(OutBuffer) {}
+
+	void WriteNull();
+	void WriteBoolean(bool InValue);
+	void WriteInteger(int64_t InValue);
+	void WriteUnsigned(uint64_t InValue);
+	void WriteDouble(double InValue);
+	void WriteString(std::string_view InValue);
+
+	void BeginObject();
+	// Start the next member of the current object; its value is written next
+	void Key(std::string_view InKey);
+	void EndObject();
+
+	void BeginArray();
+	void EndArray();
+
+	// Append text that is already valid JSON as the next value
+	void WriteRaw(std::string_view InJSON);
+	// Dump a document as the next value
+	void WriteValue(const JSONData& InValue);
+
+private:
+	// Separate the value about to be written from the previous sibling
+	void BeginValue();
+	void AppendEscaped(std::string_view InValue);
+
+	std::string& m_Buffer;
+	// Whether the next value follows a sibling in the same object or array
+	bool m_NeedsComma{ false };
+};
+
+template <typename T> void WriteJSON(JSONWriter& InWriter, const T& InValue);
+
+namespace JSONWriterDetail
+{
+	template <typename T> struct IsVector : std::false_type
+	{};
+	template <typename T, typename Alloc> struct IsVector<std::vector<T, Alloc>> : std::true_type
+	{};
+
+	template <typename T> struct IsStringMap : std::false_type
+	{};
+	template <typename T> struct IsStringMap<std::unordered_map<std::string, T>> : std::true_type
+	{};
+	template <typename T> struct IsStringMap<std::map<std::string, T>> : std::true_type
+	{};
+
+	template <typename T> struct IsUniquePtr : std::false_type
+	{};
+	template <typename T> struct IsUniquePtr<std::unique_ptr<T>> : std::true_type
+	{};
+
+	template <typename T> struct IsVariant : std::false_type
+	{};
+	template <typename... Types> struct IsVariant<std::variant<Types...>> : std::true_type
+	{};
+} // namespace JSONWriterDetail
+
+// Every JSON_KEY of the type in declaration order, base keys first; empty optionals are left out
+template <HasJSONKeys T> void WriteKeyedObject(JSONWriter& InWriter, const T& InValue)
+{
+	InWriter.BeginObject();
+	std::apply([&](const auto&... InKeys) { (InKeys.write_json(InWriter, InValue), ...); }, T::JSONKeys());
+	InWriter.EndObject();
+}
+
+/**
+ * Encode InValue as the next value. Types declared with DEFINE_TYPE_JSON are written field by field from their
+ * JSON_KEYs, and a pointer to a polymorphic message part is written as the type it points to; anything else with a
+ * to_json, such as enums or RequestID, goes through a document of its own value.
+ */
+template <typename T> void WriteJSON(JSONWriter& InWriter, const T& InValue)
+{
+	using namespace JSONWriterDetail;
+
+	if constexpr (std::is_same_v<T, JSONData>)
+	{
+		InWriter.WriteValue(InValue);
+	}
+	else if constexpr (std::is_same_v<T, bool>)
+	{
+		InWriter.WriteBoolean(InValue);
+	}
+	else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+	{
+		InWriter.WriteInteger(InValue);
+	}
+	else if constexpr (std::is_integral_v<T>)
+	{
+		InWriter.WriteUnsigned(InValue);
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		InWriter.WriteDouble(InValue);
+	}
+	else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+	{
+		InWriter.WriteString(InValue);
+	}
+	else if constexpr (IsOptional<T>)
+	{
+		if (InValue.has_value())
+		{
+			WriteJSON(InWriter, InValue.value());
+		}
+		else
+		{
+			InWriter.WriteNull();
+		}
+	}
+	else if constexpr (IsUniquePtr<T>::value)
+	{
+		if (!InValue)
+		{
+			InWriter.WriteNull();
+		}
+		else if constexpr (requires { InValue->SerializeTo(InWriter); })
+		{
+			InValue->SerializeTo(InWriter);
+		}
+		else
+		{
+			WriteJSON(InWriter, *InValue);
+		}
+	}
+	else if constexpr (IsVector<T>::value)
+	{
+		InWriter.BeginArray();
+		for (const auto& Element : InValue)
+		{
+			WriteJSON(InWriter, Element);
+		}
+		InWriter.EndArray();
+	}
+	else if constexpr (IsStringMap<T>::value)
+	{
+		InWriter.BeginObject();
+		for (const auto& [Key, Element] : InValue)
+		{
+			InWriter.Key(Key);
+			WriteJSON(InWriter, Element);
+		}
+		InWriter.EndObject();
+	}
+	else if constexpr (IsVariant<T>::value)
+	{
+		std::visit([&InWriter](const auto& InAlternative) { WriteJSON(InWriter, InAlternative); }, InValue);
+	}
+	else if constexpr (HasJSONKeys<T>)
+	{
+		WriteKeyedObject(InWriter, InValue);
+	}
+	else if constexpr (std::is_class_v<T> && std::is_convertible_v<T, double>)
+	{
+		// Numeric wrappers such as BoundedDouble
+		InWriter.WriteDouble(static_cast<double>(InValue));
+	}
+	else
+	{
+		InWriter.WriteValue(JSONData(InValue));
+	}
+}
+
+// Encode InValue into a new string
+template <typename T> [[nodiscard]] std::string EncodeJSON(const T& InValue)
+{
+	std::string Buffer;
+	JSONWriter Writer(Buffer);
+	WriteJSON(Writer, InValue);
+	return Buffer;
+}
+
+MCP_NAMESPACE_END
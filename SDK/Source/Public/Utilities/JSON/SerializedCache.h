@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "CoreSDK/Common/Macros.h"
+#include "Utilities/JSON/JSONWriter.h"
+
+MCP_NAMESPACE_BEGIN
+
+/**
+ * Serialized form of data that is read far more often than it changes, such as the lists a server publishes.
+ * Changes only bump the version; the next read serializes once and every read after it shares the same text until
+ * the next change. The owner guards the cache with its own mutex.
+ */
+class SerializedCache
+{
+public:
+	using Text = std::shared_ptr<const std::string>;
+
+	// Drop the cached text. Call with the owner's lock held whenever the data it was built from changes.
+	void Invalidate()
+	{
+		++m_Version;
+		m_Text.reset();
+	}
+
+	/**
+	 * The cached text, serialized from a snapshot first if the cache is stale.
+	 * @param InLock Holds the owner's mutex. It is released while the snapshot is serialized so writers are not held
+	 * up, and the text is only kept if nothing changed in the meantime.
+	 * @param InSnapshot Copies the data to serialize; called with the lock held
+	 */
+	template <typename LockType, typename SnapshotFunction>
+	[[nodiscard]] Text Get(LockType& InLock, const SnapshotFunction& InSnapshot)
+	{
+		if (m_Text)
+		{
+			return m_Text;
+		}
+
+		const uint64_t Version = m_Version;
+		const auto Snapshot = InSnapshot();
+		InLock.unlock();
+		auto Built = std::make_shared<const std::string>(EncodeJSON(Snapshot));
+		InLock.lock();
+
+		if (Version == m_Version)
+		{
+			m_Text = Built;
+		}
+		return Built;
+	}
+
+	// Bumped on every change, so readers can tell whether the data moved on
+	[[nodiscard]] uint64_t GetVersion() const { return m_Version; }
+
+private:
+	uint64_t m_Version{ 0 };
+	Text m_Text;
+};
+
+MCP_NAMESPACE_END
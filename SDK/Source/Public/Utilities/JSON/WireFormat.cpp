@@ -0,0 +1,62 @@
+#include "Utilities/JSON/WireFormat.h"
+
+#include <limits>
+#include <stdexcept>
+
+MCP_NAMESPACE_BEGIN
+
+namespace BinaryFrame
+{
+	void Write(const JSONData& InMessage, const EWireFormat InFormat, std::string& OutBuffer)
+	{
+		const std::size_t FrameStart = OutBuffer.size();
+		OutBuffer.push_back(static_cast<char>(InFormat));
+		// The size is filled in once the payload has been encoded in place
+		OutBuffer.append(HEADER_SIZE - 1, '\0');
+
+		if (InFormat == EWireFormat::CBOR)
+		{
+			JSONData::to_cbor(InMessage, nlohmann::detail::output_adapter<char>(OutBuffer));
+		}
+		else if (InFormat == EWireFormat::MessagePack)
+		{
+			JSONData::to_msgpack(InMessage, nlohmann::detail::output_adapter<char>(OutBuffer));
+		}
+		else
+		{
+			throw std::invalid_argument("Not a binary wire format");
+		}
+
+		const std::size_t PayloadSize = OutBuffer.size() - FrameStart - HEADER_SIZE;
+		if (PayloadSize > std::numeric_limits<uint32_t>::max())
+		{
+			OutBuffer.resize(FrameStart);
+			throw std::length_error("Message too large for a binary frame");
+		}
+		for (std::size_t Index = HEADER_SIZE - 1; Index > 0; --Index)
+		{
+			OutBuffer[FrameStart + Index] = static_cast<char>(PayloadSize >> (8 * (HEADER_SIZE - 1 - Index)));
+		}
+	}
+
+	JSONData Read(const std::string_view InFrame)
+	{
+		if (InFrame.size() < HEADER_SIZE || GetFrameSize(InFrame) != InFrame.size())
+		{
+			throw JSONData::parse_error::create(110, 0, "incomplete binary frame", nullptr);
+		}
+
+		const std::string_view Payload = InFrame.substr(HEADER_SIZE);
+		switch (static_cast<EWireFormat>(InFrame.front()))
+		{
+			case EWireFormat::CBOR:
+				return JSONData::from_cbor(Payload.begin(), Payload.end());
+			case EWireFormat::MessagePack:
+				return JSONData::from_msgpack(Payload.begin(), Payload.end());
+			default:
+				throw JSONData::parse_error::create(112, 0, "unknown binary frame tag", nullptr);
+		}
+	}
+} // namespace BinaryFrame
+
+MCP_NAMESPACE_END
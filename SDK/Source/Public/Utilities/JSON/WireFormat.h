@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "CoreSDK/Common/Macros.h"
+#include "JSONProxy.h"
+
+MCP_NAMESPACE_BEGIN
+
+// How messages are encoded on the wire. A binary format's value doubles as the tag byte of its frames.
+enum class EWireFormat : uint8_t
+{
+	JSON = 0,
+	CBOR = 1,
+	MessagePack = 2
+};
+
+DEFINE_ENUM_JSON(EWireFormat,
+	{ EWireFormat::JSON, "json" },
+	{ EWireFormat::CBOR, "cbor" },
+	{ EWireFormat::MessagePack, "msgpack" })
+
+/**
+ * Binary frames carry one message each: the tag byte of their format, the payload size as a 32-bit big-endian
+ * integer, then the payload. The tag is a control byte, which JSON text never starts with, so binary frames and
+ * lines of text can share a stream and a reader can tell each frame's encoding without being told.
+ */
+namespace BinaryFrame
+{
+	inline constexpr std::size_t HEADER_SIZE{ 5 };
+	// Tags up to this value are reserved for binary frames
+	inline constexpr unsigned char MAX_TAG{ 0x08 };
+
+	[[nodiscard]] constexpr bool IsTag(const char InByte)
+	{
+		const auto Byte = static_cast<unsigned char>(InByte);
+		return Byte != 0 && Byte <= MAX_TAG;
+	}
+
+	// Size of the whole frame whose header starts InBytes, which must hold at least HEADER_SIZE bytes
+	[[nodiscard]] constexpr std::size_t GetFrameSize(const std::string_view InBytes)
+	{
+		std::size_t PayloadSize{ 0 };
+		for (std::size_t Index = 1; Index < HEADER_SIZE; ++Index)
+		{
+			PayloadSize = (PayloadSize << 8) | static_cast<unsigned char>(InBytes[Index]);
+		}
+		return HEADER_SIZE + PayloadSize;
+	}
+
+	// Append InMessage to OutBuffer as a frame of InFormat, which must be a binary format
+	void Write(const JSONData& InMessage, EWireFormat InFormat, std::string& OutBuffer);
+
+	// Decode a complete frame; throws JSONData::parse_error if it is malformed
+	[[nodiscard]] JSONData Read(std::string_view InFrame);
+} // namespace BinaryFrame
+
+MCP_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include "CoreSDK/Core/MCPServer.h"
 #include "CoreSDK/Messages/MCPMessages.h"
 #include "CoreSDK/Transport/HTTPTransport.h"
+#include "Utilities/Async/SyncWait.h"
 
 class MCPHTTPServerApp : public Poco::Util::ServerApplication
 {
@@ -20,16 +21,17 @@ protected:
 			MCP::Implementation{ "MCP HTTP Server", "V1.0.0", MCP::EProtocolVersion::V2025_03_26 },
 			MCP::ServerCapabilities{} };
 
-		Server.Start();
+		MCP::SyncWait(Server.Start());
 
 		MCP::PingRequest pingRequest;
+		pingRequest.ID = MCP::RequestID{ int64_t{ 1 } };
 		MCP::JSONData Json = pingRequest;
 		std::cout << "\n PingRequest JSON:" << std::endl;
 		std::cout << Json.dump(2) << std::endl;
 
 		waitForTerminationRequest();
 
-		Server.Stop();
+		MCP::SyncWait(Server.Stop());
 		return Application::EXIT_OK;
 	}
 };
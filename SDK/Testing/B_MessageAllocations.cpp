@@ -0,0 +1,128 @@
+/**
+ * Counts the heap allocations it takes to route one inbound message to its handler, for each form a message can
+ * arrive in. Replaces the global operator new, so it is built as its own executable rather than into sdk_tests.
+ * Fails if routing a message borrowed from the reader's buffer costs as much as routing a copy of it, or if either
+ * costs as much as going through a parsed document first, which is what every message used to pay.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+
+#include "CoreSDK/Messages/MCPMessages.h"
+#include "CoreSDK/Messages/MessageManager.h"
+#include "Utilities/JSON/JSONMessages.h"
+
+namespace
+{
+	std::atomic<uint64_t> g_Allocations{ 0 };
+
+	constexpr int WARMUP_MESSAGES{ 1000 };
+	constexpr int MEASURED_MESSAGES{ 100000 };
+
+	struct Measurement
+	{
+		double AllocationsPerMessage{ 0.0 };
+		double NanosecondsPerMessage{ 0.0 };
+	};
+
+	template <typename Function> Measurement Measure(Function&& InRouteOne)
+	{
+		for (int Index = 0; Index < WARMUP_MESSAGES; ++Index)
+		{
+			InRouteOne();
+		}
+
+		const uint64_t Before = g_Allocations.load(std::memory_order_relaxed);
+		const auto Start = std::chrono::steady_clock::now();
+		for (int Index = 0; Index < MEASURED_MESSAGES; ++Index)
+		{
+			InRouteOne();
+		}
+		const auto Elapsed = std::chrono::steady_clock::now() - Start;
+		const uint64_t Allocations = g_Allocations.load(std::memory_order_relaxed) - Before;
+
+		return Measurement{ static_cast<double>(Allocations) / MEASURED_MESSAGES,
+			static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed).count())
+				/ MEASURED_MESSAGES };
+	}
+
+	void Report(const std::string_view InLabel, const Measurement& InMeasurement)
+	{
+		std::cout << std::left << std::setw(34) << InLabel << std::right << std::fixed << std::setprecision(2)
+				  << std::setw(10) << InMeasurement.AllocationsPerMessage << " allocs/msg" << std::setw(12)
+				  << InMeasurement.NanosecondsPerMessage << " ns/msg" << std::endl;
+	}
+
+	// Routes one message in every form it can arrive in and checks that each form is cheaper than the one before
+	bool RunCase(const std::string_view InLabel, const std::string& InFrame, MCP::MessageManager& InManager)
+	{
+		std::cout << InLabel << " (" << InFrame.size() << " bytes)" << std::endl;
+
+		const Measurement Document = Measure(
+			[&]
+			{
+				InManager.RouteMessage(
+					MCP::InboundMessage{ std::in_place_type<MCP::JSONData>, MCP::JSONData::parse(InFrame) });
+			});
+		const Measurement Owned
+			= Measure([&] { InManager.RouteMessage(MCP::InboundMessage{ std::in_place_type<std::string>, InFrame }); });
+		const Measurement Borrowed = Measure(
+			[&] { InManager.RouteMessage(MCP::InboundMessage{ std::in_place_type<std::string_view>, InFrame }); });
+
+		Report("  parsed document", Document);
+		Report("  owned copy of the frame", Owned);
+		Report("  borrowed from the frame buffer", Borrowed);
+
+		return Owned.AllocationsPerMessage < Document.AllocationsPerMessage
+			&& Borrowed.AllocationsPerMessage < Owned.AllocationsPerMessage;
+	}
+} // namespace
+
+void* operator new(const std::size_t InSize)
+{
+	g_Allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* Block = std::malloc(InSize == 0 ? 1 : InSize))
+	{
+		return Block;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* InBlock) noexcept { std::free(InBlock); }
+void operator delete(void* InBlock, std::size_t) noexcept { std::free(InBlock); }
+
+int main()
+{
+	const auto Manager = std::make_shared<MCP::MessageManager>(true);
+
+	std::size_t Handled{ 0 };
+	Manager->RegisterRequestHandler<MCP::PingRequest>([&Handled](const MCP::PingRequest&) { ++Handled; });
+	Manager->RegisterRequestHandler<MCP::CallToolRequest>([&Handled](const MCP::CallToolRequest&) { ++Handled; });
+
+	// Frames longer than the small-string buffer, as every real message is
+	const std::string Ping = R"({"jsonrpc":"2.0","id":1234567,"method":"ping"})";
+	const std::string CallTool = R"({"jsonrpc":"2.0","id":1234568,"method":"tools/call","params":{"name":"search",)"
+								 R"("arguments":{"query":"allocation counts","limit":10,"exact":false}}})";
+
+	bool IsReduced = RunCase("ping", Ping, *Manager);
+	IsReduced = RunCase("tools/call", CallTool, *Manager) && IsReduced;
+
+	if (Handled != 6 * static_cast<std::size_t>(WARMUP_MESSAGES + MEASURED_MESSAGES))
+	{
+		std::cout << "Not every message reached its handler" << std::endl;
+		return 1;
+	}
+	if (!IsReduced)
+	{
+		std::cout << "Routing without a copy no longer saves allocations" << std::endl;
+		return 1;
+	}
+	return 0;
+}
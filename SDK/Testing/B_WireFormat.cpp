@@ -0,0 +1,163 @@
+/**
+ * Compares the wire formats a session can negotiate: the payload size of representative messages and the time it
+ * takes to encode and decode each one as JSON text, as a CBOR frame and as a MessagePack frame. Fails if a message
+ * does not come back unchanged from any of them, since a faster encoding that loses data is no encoding at all.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "JSONProxy.h"
+#include "Utilities/JSON/JSONWriter.h"
+#include "Utilities/JSON/WireFormat.h"
+
+namespace
+{
+	constexpr int WARMUP_MESSAGES{ 100 };
+	// Each case is timed over about this many bytes of JSON text, so large messages are not run for minutes
+	constexpr std::size_t MEASURED_BYTES{ 16 * 1024 * 1024 };
+	constexpr int MIN_MEASURED_MESSAGES{ 200 };
+
+	// Every decoded message is fed into this, so the decode cannot be optimized away
+	volatile std::size_t g_Sink{ 0 };
+
+	struct Measurement
+	{
+		std::size_t PayloadBytes{ 0 };
+		double EncodeNanoseconds{ 0.0 };
+		double DecodeNanoseconds{ 0.0 };
+		bool IsRoundTrip{ false };
+	};
+
+	template <typename Function> double TimePerMessage(const int InMessages, Function&& InRunOne)
+	{
+		for (int Index = 0; Index < WARMUP_MESSAGES; ++Index)
+		{
+			InRunOne();
+		}
+
+		const auto Start = std::chrono::steady_clock::now();
+		for (int Index = 0; Index < InMessages; ++Index)
+		{
+			InRunOne();
+		}
+		const auto Elapsed = std::chrono::steady_clock::now() - Start;
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed).count()) / InMessages;
+	}
+
+	Measurement MeasureJSON(const MCP::JSONData& InMessage, const int InMessages)
+	{
+		std::string Text;
+		Measurement Result;
+		Result.EncodeNanoseconds = TimePerMessage(InMessages,
+			[&]
+			{
+				Text.clear();
+				MCP::JSONWriter(Text).WriteValue(InMessage);
+			});
+		Result.PayloadBytes = Text.size();
+		Result.DecodeNanoseconds = TimePerMessage(InMessages, [&] { g_Sink = MCP::JSONData::parse(Text).size(); });
+		Result.IsRoundTrip = MCP::JSONData::parse(Text) == InMessage;
+		return Result;
+	}
+
+	Measurement MeasureBinary(const MCP::JSONData& InMessage, const MCP::EWireFormat InFormat, const int InMessages)
+	{
+		std::string Frame;
+		Measurement Result;
+		Result.EncodeNanoseconds = TimePerMessage(InMessages,
+			[&]
+			{
+				Frame.clear();
+				MCP::BinaryFrame::Write(InMessage, InFormat, Frame);
+			});
+		Result.PayloadBytes = Frame.size() - MCP::BinaryFrame::HEADER_SIZE;
+		Result.DecodeNanoseconds = TimePerMessage(InMessages, [&] { g_Sink = MCP::BinaryFrame::Read(Frame).size(); });
+		Result.IsRoundTrip = MCP::BinaryFrame::Read(Frame) == InMessage;
+		return Result;
+	}
+
+	void Report(const std::string_view InLabel, const Measurement& InMeasurement, const std::size_t InJSONBytes)
+	{
+		std::cout << std::left << std::setw(14) << InLabel << std::right << std::setw(9) << InMeasurement.PayloadBytes
+				  << " bytes" << std::fixed << std::setprecision(0) << std::setw(5)
+				  << 100.0 * static_cast<double>(InMeasurement.PayloadBytes) / static_cast<double>(InJSONBytes) << "%"
+				  << std::setprecision(2) << std::setw(12) << InMeasurement.EncodeNanoseconds << " ns encode"
+				  << std::setw(12) << InMeasurement.DecodeNanoseconds << " ns decode" << std::endl;
+	}
+
+	// Measures one message in every format and reports whether each of them carried it intact
+	bool RunCase(const std::string_view InLabel, const MCP::JSONData& InMessage)
+	{
+		const std::size_t TextSize = InMessage.dump().size();
+		const int Messages = std::max(MIN_MEASURED_MESSAGES, static_cast<int>(MEASURED_BYTES / TextSize));
+		std::cout << InLabel << " (" << Messages << " messages)" << std::endl;
+
+		const Measurement JSON = MeasureJSON(InMessage, Messages);
+		const Measurement CBOR = MeasureBinary(InMessage, MCP::EWireFormat::CBOR, Messages);
+		const Measurement MessagePack = MeasureBinary(InMessage, MCP::EWireFormat::MessagePack, Messages);
+
+		Report("  json", JSON, JSON.PayloadBytes);
+		Report("  cbor", CBOR, JSON.PayloadBytes);
+		Report("  msgpack", MessagePack, JSON.PayloadBytes);
+
+		return JSON.IsRoundTrip && CBOR.IsRoundTrip && MessagePack.IsRoundTrip;
+	}
+
+	MCP::JSONData MakeToolsList(const int InToolCount)
+	{
+		MCP::JSONData Tools = MCP::JSONData::array();
+		for (int Index = 0; Index < InToolCount; ++Index)
+		{
+			Tools.push_back({ { "name", "tool_" + std::to_string(Index) },
+				{ "description", "Looks up records matching a query and returns at most the requested number of them" },
+				{ "inputSchema",
+					{ { "type", "object" },
+						{ "properties",
+							{ { "query", { { "type", "string" } } },
+								{ "limit", { { "type", "integer" }, { "minimum", 1 }, { "maximum", 100 } } },
+								{ "exact", { { "type", "boolean" } } } } },
+						{ "required", { "query" } } } } });
+		}
+		return { { "jsonrpc", "2.0" }, { "id", 1234569 }, { "result", { { "tools", std::move(Tools) } } } };
+	}
+
+	// A tool result made mostly of numbers, which binary formats encode most compactly
+	MCP::JSONData MakeNumericResult(const int InSampleCount)
+	{
+		MCP::JSONData Samples = MCP::JSONData::array();
+		for (int Index = 0; Index < InSampleCount; ++Index)
+		{
+			Samples.push_back({ { "t", 1700000000 + Index }, { "value", Index * 0.25 }, { "valid", Index % 7 != 0 } });
+		}
+		return { { "jsonrpc", "2.0" }, { "id", 1234570 },
+			{ "result",
+				{ { "content", { { { "type", "text" }, { "text", "Sampled the sensor" } } } },
+					{ "structuredContent", { { "samples", std::move(Samples) } } } } } };
+	}
+} // namespace
+
+int main()
+{
+	const MCP::JSONData Ping = MCP::JSONData::parse(R"({"jsonrpc":"2.0","id":1234567,"method":"ping"})");
+	const MCP::JSONData CallTool
+		= MCP::JSONData::parse(R"({"jsonrpc":"2.0","id":1234568,"method":"tools/call","params":{"name":"search",)"
+							   R"("arguments":{"query":"allocation counts","limit":10,"exact":false}}})");
+
+	bool IsIntact = RunCase("ping", Ping);
+	IsIntact = RunCase("tools/call", CallTool) && IsIntact;
+	IsIntact = RunCase("tools/list result, 50 tools", MakeToolsList(50)) && IsIntact;
+	IsIntact = RunCase("tool result, 5000 samples", MakeNumericResult(5000)) && IsIntact;
+
+	if (!IsIntact)
+	{
+		std::cout << "A message did not survive a round trip through its wire format" << std::endl;
+		return 1;
+	}
+	return 0;
+}
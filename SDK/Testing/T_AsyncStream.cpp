@@ -0,0 +1,85 @@
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include "TestHarness.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/Async/Task.h"
+#include "Utilities/Async/TaskCombinators.h"
+#include "Utilities/IO/AsyncStream.h"
+#include "Utilities/IO/IOReactor.h"
+
+#if !defined(_WIN32)
+	#include <sys/socket.h>
+	#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	// Large enough to fill the socket's buffers, so the write has to wait for room
+	constexpr std::size_t WRITE_SIZE{ 4 * 1024 * 1024 };
+
+	MCP::Task<std::tuple<std::size_t, bool>> ReadWhileWriting(MCP::AsyncStream& InStream,
+		std::span<char> OutBuffer,
+		const std::string& InData)
+	{
+		MCP::Task<std::size_t> Read = InStream.Read(OutBuffer);
+		MCP::Task<bool> Write = InStream.Write(InData);
+		co_return co_await MCP::WhenAll(Read, Write);
+	}
+} // namespace
+
+// A write that has to wait while a read is pending parks alongside it instead of spinning until the read completes
+MCP_TEST(AsyncStream_ReadAndWriteWaitOnTheSameHandle)
+{
+	int Sockets[2];
+	MCP_CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, Sockets), 0);
+
+	MCP::IOReactor Reactor(1);
+	MCP::AsyncStream Stream(Sockets[0], Reactor);
+	const std::string Data(WRITE_SIZE, 'w');
+	std::array<char, 16> Buffer{};
+
+	std::clock_t ParkedCPU{ 0 };
+	std::size_t Drained{ 0 };
+	std::thread Peer(
+		[&]
+		{
+			// Both directions are parked by now; a busy wait would burn this whole interval
+			std::this_thread::sleep_for(100ms);
+			const std::clock_t Start = std::clock();
+			std::this_thread::sleep_for(300ms);
+			ParkedCPU = std::clock() - Start;
+
+			std::array<char, 65536> Chunk{};
+			while (Drained < WRITE_SIZE)
+			{
+				const auto Count = read(Sockets[1], Chunk.data(), Chunk.size());
+				if (Count <= 0)
+				{
+					break;
+				}
+				Drained += static_cast<std::size_t>(Count);
+			}
+			(void)write(Sockets[1], "r", 1);
+		});
+
+	const auto [ReadCount, IsWritten] = MCP::SyncWait(ReadWhileWriting(Stream, Buffer, Data));
+	Peer.join();
+
+	MCP_CHECK_EQ(ReadCount, std::size_t{ 1 });
+	MCP_CHECK_EQ(Buffer[0], 'r');
+	MCP_CHECK(IsWritten);
+	MCP_CHECK_EQ(Drained, WRITE_SIZE);
+	MCP_CHECK(ParkedCPU < CLOCKS_PER_SEC / 10);
+	MCP_CHECK_EQ(Reactor.GetWatchCount(), std::size_t{ 0 });
+
+	close(Sockets[0]);
+	close(Sockets[1]);
+}
+#endif
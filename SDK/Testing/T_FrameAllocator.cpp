@@ -0,0 +1,89 @@
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "TestHarness.h"
+#include "Utilities/Async/FrameAllocator.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/Async/Task.h"
+
+namespace
+{
+	MCP::Task<int> Leaf(const int InValue) { co_return InValue; }
+
+	MCP::Task<int> Chain(const int InDepth)
+	{
+		int Sum{ 0 };
+		for (int Index = 0; Index < InDepth; ++Index)
+		{
+			Sum += co_await Leaf(Index);
+		}
+		co_return Sum;
+	}
+} // namespace
+
+MCP_TEST(FrameAllocator_ReusesFreedFramesOfTheSameSizeClass)
+{
+	constexpr std::size_t FRAME_SIZE{ 200 };
+
+	// Warm the class up so the next allocation can only be a hit
+	MCP::FrameAllocator::Deallocate(MCP::FrameAllocator::Allocate(FRAME_SIZE), FRAME_SIZE);
+	const MCP::FrameAllocatorStats Before = MCP::FrameAllocator::GetStats();
+
+	void* Frame = MCP::FrameAllocator::Allocate(FRAME_SIZE);
+	std::memset(Frame, 0xAB, FRAME_SIZE);
+	MCP::FrameAllocator::Deallocate(Frame, FRAME_SIZE);
+
+	const MCP::FrameAllocatorStats After = MCP::FrameAllocator::GetStats();
+	MCP_CHECK(After.PoolHits >= Before.PoolHits + 1);
+}
+
+MCP_TEST(FrameAllocator_AllocatesOversizedFramesDirectly)
+{
+	constexpr std::size_t FRAME_SIZE{ MCP::FrameAllocator::MAX_CLASS_SIZE * 2 };
+
+	const MCP::FrameAllocatorStats Before = MCP::FrameAllocator::GetStats();
+	void* Frame = MCP::FrameAllocator::Allocate(FRAME_SIZE);
+	std::memset(Frame, 0xCD, FRAME_SIZE);
+	MCP::FrameAllocator::Deallocate(Frame, FRAME_SIZE);
+	MCP_CHECK(MCP::FrameAllocator::GetStats().Oversized >= Before.Oversized + 1);
+}
+
+MCP_TEST(FrameAllocator_ArenaServesFramesUntilItIsFull)
+{
+	const MCP::FrameAllocatorStats Before = MCP::FrameAllocator::GetStats();
+	std::vector<void*> Frames;
+	{
+		const MCP::FrameArena::Scope Arena(1024);
+		for (int Index = 0; Index < 8; ++Index)
+		{
+			Frames.push_back(MCP::FrameAllocator::Allocate(64));
+		}
+		// Does not fit in what is left, so it falls back to the pool
+		Frames.push_back(MCP::FrameAllocator::Allocate(900));
+	}
+	const MCP::FrameAllocatorStats After = MCP::FrameAllocator::GetStats();
+	MCP_CHECK(After.ArenaFrames >= Before.ArenaFrames + 8);
+	MCP_CHECK(After.PoolHits + After.PoolMisses >= Before.PoolHits + Before.PoolMisses + 1);
+
+	// The arena outlives its scope until the last of its frames is gone, whichever thread frees it
+	std::thread([&Frames]
+		{
+			for (std::size_t Index = 0; Index < Frames.size(); ++Index)
+			{
+				MCP::FrameAllocator::Deallocate(Frames[Index], Index + 1 < Frames.size() ? 64 : 900);
+			}
+		})
+		.join();
+}
+
+MCP_TEST(FrameAllocator_BacksTaskFrames)
+{
+	MCP_CHECK_EQ(MCP::SyncWait(Chain(10)), 45);
+
+	const MCP::FrameAllocatorStats Before = MCP::FrameAllocator::GetStats();
+	MCP_CHECK_EQ(MCP::SyncWait(Chain(10)), 45);
+	const MCP::FrameAllocatorStats After = MCP::FrameAllocator::GetStats();
+	// Every frame of the second run comes back out of the free lists the first one filled
+	MCP_CHECK(After.PoolHits >= Before.PoolHits + 10);
+}
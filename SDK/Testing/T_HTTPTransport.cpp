@@ -0,0 +1,146 @@
+#include <Poco/Net/HTTPClientSession.h>
+#include <Poco/Net/HTTPRequest.h>
+#include <Poco/Net/HTTPResponse.h>
+#include <Poco/StreamCopier.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CoreSDK/Messages/MCPMessages.h"
+#include "CoreSDK/Messages/MessageManager.h"
+#include "CoreSDK/Transport/HTTPTransport.h"
+#include "CoreSDK/Transport/ITransport.h"
+#include "TestHarness.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/JSON/JSONMessages.h"
+
+namespace
+{
+	// Fixed so the client knows where to connect; chosen well clear of the ports MCP servers usually take
+	constexpr uint16_t TEST_PORT{ 38517 };
+
+	constexpr auto SESSION_HEADER = "Mcp-Session-Id";
+	constexpr auto INITIALIZE = R"({"jsonrpc":"2.0","id":1,"method":"initialize"})";
+
+	struct PostResult
+	{
+		int Status{ 0 };
+		std::string Body;
+		std::string SessionID;
+	};
+
+	PostResult Post(const std::string& InPath, const std::string& InBody, const std::string& InSessionID = {})
+	{
+		Poco::Net::HTTPClientSession Session("127.0.0.1", TEST_PORT);
+		Poco::Net::HTTPRequest Request(Poco::Net::HTTPRequest::HTTP_POST, InPath, Poco::Net::HTTPMessage::HTTP_1_1);
+		Request.setContentType("application/json");
+		Request.set("Accept", "application/json");
+		if (!InSessionID.empty())
+		{
+			Request.set(SESSION_HEADER, InSessionID);
+		}
+		Request.setContentLength(static_cast<std::streamsize>(InBody.size()));
+		Session.sendRequest(Request) << InBody;
+
+		Poco::Net::HTTPResponse Response;
+		PostResult Result;
+		Poco::StreamCopier::copyToString(Session.receiveResponse(Response), Result.Body);
+		Result.Status = static_cast<int>(Response.getStatus());
+		Result.SessionID = Response.get(SESSION_HEADER, "");
+		return Result;
+	}
+} // namespace
+
+// A server-side transport built by the factory has to listen, hand each POST to its router and carry the reply back
+MCP_TEST(HTTPTransport_ServerAnswersARequestOnItsPost)
+{
+	auto Options = std::make_unique<MCP::HTTPTransportOptions>();
+	Options->Port = TEST_PORT;
+	const std::string Path = Options->Path;
+	const std::optional<std::unique_ptr<MCP::TransportOptions>> FactoryOptions{ std::move(Options) };
+
+	const std::unique_ptr<MCP::ITransport> Transport = MCP::TransportFactory::CreateTransport(
+		MCP::ETransportType::StreamableHTTP, MCP::ETransportSide::Server, FactoryOptions);
+	MCP_CHECK(dynamic_cast<MCP::HTTPTransportServer*>(Transport.get()) != nullptr);
+
+	std::atomic<int> Routed{ 0 };
+	Transport->SetMessageRouter(
+		[&Transport, &Routed](MCP::InboundMessage InMessage, const std::optional<MCP::ConnectionID>& InConnectionID)
+		{
+			++Routed;
+			const MCP::MessageEnvelope Envelope = MCP::GetEnvelope(InMessage);
+			std::optional<std::vector<MCP::ConnectionID>> ReplyTo;
+			if (InConnectionID)
+			{
+				ReplyTo.emplace({ *InConnectionID });
+			}
+			Transport->TransmitMessage(MCP::PingResponse{ Envelope.ID.value() }, ReplyTo);
+		});
+
+	MCP::SyncWait(Transport->Connect());
+	MCP_CHECK(Transport->IsConnected());
+
+	// Everything but initialize has to name the session initialize opened
+	const std::string Ping = R"({"jsonrpc":"2.0","id":17,"method":"ping"})";
+	MCP_CHECK_EQ(Post(Path, Ping).Status, 400);
+	MCP_CHECK_EQ(Routed.load(), 0);
+
+	const PostResult Initialized = Post(Path, INITIALIZE);
+	MCP_CHECK_EQ(Initialized.Status, 200);
+	MCP_CHECK(!Initialized.SessionID.empty());
+
+	const PostResult Reply = Post(Path, Ping, Initialized.SessionID);
+	MCP_CHECK_EQ(Reply.Status, 200);
+	MCP_CHECK_EQ(Routed.load(), 2);
+
+	const MCP::JSONData Response = MCP::JSONData::parse(Reply.Body);
+	MCP_CHECK_EQ(Response.at("id").get<int>(), 17);
+	MCP_CHECK(Response.contains("result"));
+
+	MCP_CHECK_EQ(Post(Path + "/unknown", "{}").Status, 404);
+
+	MCP::SyncWait(Transport->Disconnect());
+	MCP_CHECK(!Transport->IsConnected());
+}
+
+// A request nobody handles is still answered on its POST, rather than leaving the exchange open until it times out
+MCP_TEST(HTTPTransport_ServerAnswersAnUnknownMethodWithAnError)
+{
+	auto Options = std::make_unique<MCP::HTTPTransportOptions>();
+	Options->Port = TEST_PORT;
+	const std::string Path = Options->Path;
+	const std::optional<std::unique_ptr<MCP::TransportOptions>> FactoryOptions{ std::move(Options) };
+
+	const std::unique_ptr<MCP::ITransport> Transport = MCP::TransportFactory::CreateTransport(
+		MCP::ETransportType::StreamableHTTP, MCP::ETransportSide::Server, FactoryOptions);
+
+	const auto Manager = std::make_shared<MCP::MessageManager>(true);
+	Manager->SetErrorReplySender(
+		[&Transport](const MCP::ErrorResponseBase& InError, const std::optional<MCP::ConnectionID>& InConnectionID)
+		{
+			std::optional<std::vector<MCP::ConnectionID>> ReplyTo;
+			if (InConnectionID)
+			{
+				ReplyTo.emplace({ *InConnectionID });
+			}
+			Transport->TransmitMessage(InError, ReplyTo);
+		});
+	Transport->SetMessageRouter(
+		[&Manager](MCP::InboundMessage InMessage, const std::optional<MCP::ConnectionID>& InConnectionID)
+		{ Manager->RouteMessage(std::move(InMessage), InConnectionID); });
+
+	MCP::SyncWait(Transport->Connect());
+
+	const std::string SessionID = Post(Path, INITIALIZE).SessionID;
+	const PostResult Reply = Post(Path, R"({"jsonrpc":"2.0","id":18,"method":"tools/unheard_of"})", SessionID);
+	MCP_CHECK_EQ(Reply.Status, 200);
+
+	const MCP::JSONData Response = MCP::JSONData::parse(Reply.Body);
+	MCP_CHECK_EQ(Response.at("id").get<int>(), 18);
+	MCP_CHECK_EQ(Response.at("error").at("code").get<int>(), -32601);
+
+	MCP::SyncWait(Transport->Disconnect());
+}
@@ -0,0 +1,146 @@
+#include <string>
+#include <unordered_map>
+
+#include "CoreSDK/Messages/MCPMessages.h"
+#include "TestHarness.h"
+#include "Utilities/JSON/JSONMessages.h"
+#include "Utilities/JSON/JSONReader.h"
+#include "Utilities/JSON/JSONWriter.h"
+#include "Utilities/JSON/WireFormat.h"
+
+MCP_TEST(JSON_WriterOutputParsesBackToTheSameDocument)
+{
+	const MCP::JSONData Document = MCP::JSONData::parse(R"({
+		"text": "quote \" backslash \\ newline \n tab \t control \u0001 unicode é",
+		"numbers": [0, -1, 9007199254740993, 1.5, -2.25e-8],
+		"flags": [true, false, null],
+		"nested": { "empty": {}, "list": [] }
+	})");
+
+	std::string Text;
+	MCP::JSONWriter(Text).WriteValue(Document);
+	MCP_CHECK(MCP::JSONData::parse(Text) == Document);
+	MCP_CHECK_EQ(MCP::EncodeJSON(Document), Text);
+}
+
+MCP_TEST(JSON_ReaderWalksADocumentWithoutBuildingIt)
+{
+	MCP::JSONReader Reader(R"( { "id" : 42, "name" : "\u00e9t\u00e9", "skip": {"deep": [1, {"x": null}]},
+		"raw": [1, 2], "ratio": 0.5 } )");
+
+	Reader.BeginObject();
+	MCP_CHECK(Reader.NextKey().value() == "id");
+	MCP_CHECK_EQ(Reader.ReadInteger(), int64_t{ 42 });
+	MCP_CHECK(Reader.NextKey().value() == "name");
+	MCP_CHECK_EQ(Reader.ReadString(), std::string{ "\xc3\xa9t\xc3\xa9" });
+	MCP_CHECK(Reader.NextKey().value() == "skip");
+	Reader.Skip();
+	MCP_CHECK(Reader.NextKey().value() == "raw");
+	MCP_CHECK(Reader.ReadRaw() == "[1, 2]");
+	MCP_CHECK(Reader.NextKey().value() == "ratio");
+	MCP_CHECK_EQ(Reader.ReadDouble(), 0.5);
+	MCP_CHECK(!Reader.NextKey().has_value());
+	Reader.ExpectEnd();
+}
+
+MCP_TEST(JSON_ReaderRejectsMalformedText)
+{
+	const auto ReadAll = [](const std::string_view InText)
+	{
+		MCP::JSONReader Reader(InText);
+		Reader.Skip();
+		Reader.ExpectEnd();
+	};
+
+	MCP_CHECK_THROWS(ReadAll(R"({"a":1,})"), MCP::JSONData::parse_error);
+	MCP_CHECK_THROWS(ReadAll(R"({"a" 1})"), MCP::JSONData::parse_error);
+	MCP_CHECK_THROWS(ReadAll(R"("unterminated)"), MCP::JSONData::parse_error);
+	MCP_CHECK_THROWS(ReadAll(R"([1, 2] trailing)"), MCP::JSONData::parse_error);
+}
+
+MCP_TEST(JSON_RequestRoundTripsThroughTheWriterAndReader)
+{
+	MCP::CallToolRequest Request(MCP::CallToolRequest::Params{ "echo",
+		std::unordered_map<std::string, MCP::JSONData>{ { "text", "hi \"there\"\n" }, { "count", 3 } } });
+	Request.ID = MCP::RequestID{ int64_t{ 5 } };
+
+	std::string Text;
+	MCP::WriteFramedMessage(Request, Text);
+
+	// The fast path must produce what the document path would have
+	MCP::JSONData Document;
+	Request.SerializeTo(Document);
+	MCP_CHECK(MCP::JSONData::parse(Text) == Document);
+
+	const MCP::CallToolRequest Decoded = MCP::DecodeRequest<MCP::CallToolRequest>(Text);
+	MCP_CHECK_EQ(Decoded.ID.ToString(), std::string{ "5" });
+	MCP_CHECK(Decoded.Method == MCP::CallToolRequest::METHOD);
+	MCP_CHECK(Decoded.ParamsData.has_value());
+	const auto* Params = dynamic_cast<const MCP::CallToolRequest::Params*>(Decoded.ParamsData.value().get());
+	MCP_CHECK(Params != nullptr);
+	MCP_CHECK_EQ(Params->Name, std::string{ "echo" });
+	MCP_CHECK(Params->Arguments.has_value());
+	MCP_CHECK_EQ(Params->Arguments->at("text").get<std::string>(), std::string{ "hi \"there\"\n" });
+	MCP_CHECK_EQ(Params->Arguments->at("count").get<int>(), 3);
+}
+
+MCP_TEST(JSON_EnvelopeIsReadWithoutTheRest)
+{
+	const MCP::MessageEnvelope Envelope
+		= MCP::ScanEnvelope(R"({"jsonrpc":"2.0","id":"abc","method":"tools/list","params":{"cursor":"c"}})");
+	MCP_CHECK(Envelope.IsValid());
+	MCP_CHECK(Envelope.Type == MCP::EMessageType::Request);
+	MCP_CHECK_EQ(Envelope.Method, std::string{ "tools/list" });
+	MCP_CHECK_EQ(Envelope.ID.value().ToString(), std::string{ "abc" });
+
+	const MCP::MessageEnvelope Notification
+		= MCP::ScanEnvelope(R"({"jsonrpc":"2.0","method":"notifications/initialized"})");
+	MCP_CHECK(Notification.Type == MCP::EMessageType::Notification);
+	MCP_CHECK(!Notification.ID.has_value());
+}
+
+MCP_TEST(BinaryFrame_RoundTripsEveryBinaryFormat)
+{
+	const MCP::JSONData Message = MCP::JSONData::parse(
+		R"({"jsonrpc":"2.0","id":9,"result":{"content":[{"type":"text","text":"ok"}],"big":4294967297,"pi":3.14}})");
+
+	for (const MCP::EWireFormat Format : { MCP::EWireFormat::CBOR, MCP::EWireFormat::MessagePack })
+	{
+		std::string Frame{ "prefix" };
+		MCP::BinaryFrame::Write(Message, Format, Frame);
+		const std::string_view Written = std::string_view{ Frame }.substr(6);
+
+		MCP_CHECK(MCP::BinaryFrame::IsTag(Written.front()));
+		MCP_CHECK_EQ(static_cast<int>(Written.front()), static_cast<int>(Format));
+		MCP_CHECK_EQ(MCP::BinaryFrame::GetFrameSize(Written), Written.size());
+		MCP_CHECK(MCP::BinaryFrame::Read(Written) == Message);
+	}
+}
+
+MCP_TEST(BinaryFrame_RejectsTruncatedFrames)
+{
+	std::string Frame;
+	MCP::BinaryFrame::Write(MCP::JSONData{ { "id", 1 } }, MCP::EWireFormat::CBOR, Frame);
+	MCP_CHECK_THROWS(MCP::BinaryFrame::Read(std::string_view{ Frame }.substr(0, Frame.size() - 1)),
+		MCP::JSONData::parse_error);
+	MCP_CHECK(!MCP::BinaryFrame::IsTag('{'));
+	MCP_CHECK(!MCP::BinaryFrame::IsTag('\0'));
+}
+
+MCP_TEST(JSON_ReaderRejectsNestingPastTheDepthLimit)
+{
+	const auto SkipAll = [](const std::string& InText)
+	{
+		MCP::JSONReader Reader(InText);
+		Reader.Skip();
+		Reader.ExpectEnd();
+	};
+	const auto Nested = [](const std::size_t InDepth) { return std::string(InDepth, '[') + std::string(InDepth, ']'); };
+
+	SkipAll(Nested(MCP::JSONReader::MAX_DEPTH));
+	MCP_CHECK_THROWS(SkipAll(Nested(MCP::JSONReader::MAX_DEPTH + 1)), MCP::JSONData::parse_error);
+	// Deep enough to overflow the stack of a reader that recursed
+	MCP_CHECK_THROWS(SkipAll(std::string(2000000, '[')), MCP::JSONData::parse_error);
+	// Members ahead of the envelope are skipped the same way
+	MCP_CHECK_THROWS(MCP::ScanEnvelope(R"({"params":)" + std::string(2000000, '[')), MCP::JSONData::parse_error);
+}
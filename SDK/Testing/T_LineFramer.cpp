@@ -0,0 +1,84 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "TestHarness.h"
+#include "Utilities/IO/LineFramer.h"
+#include "Utilities/JSON/WireFormat.h"
+
+namespace
+{
+	std::vector<std::string> Drain(MCP::LineFramer& InFramer)
+	{
+		std::vector<std::string> Frames;
+		InFramer.ConsumeFrames([&Frames](const std::string_view InFrame) { Frames.emplace_back(InFrame); });
+		return Frames;
+	}
+} // namespace
+
+MCP_TEST(LineFramer_SplitsLinesAndStripsCarriageReturns)
+{
+	MCP::LineFramer Framer;
+	Framer.Append("{\"a\":1}\n{\"b\":2}\r\n\n{\"c\":");
+
+	const std::vector<std::string> Frames = Drain(Framer);
+	MCP_CHECK_EQ(Frames.size(), std::size_t{ 2 });
+	MCP_CHECK_EQ(Frames[0], std::string{ "{\"a\":1}" });
+	MCP_CHECK_EQ(Frames[1], std::string{ "{\"b\":2}" });
+	MCP_CHECK_EQ(Framer.GetBufferedSize(), std::size_t{ 5 });
+
+	Framer.Append("3}\n");
+	const std::vector<std::string> Rest = Drain(Framer);
+	MCP_CHECK_EQ(Rest.size(), std::size_t{ 1 });
+	MCP_CHECK_EQ(Rest[0], std::string{ "{\"c\":3}" });
+	MCP_CHECK_EQ(Framer.GetBufferedSize(), std::size_t{ 0 });
+}
+
+MCP_TEST(LineFramer_ReassemblesBytesWrittenOneAtATime)
+{
+	MCP::LineFramer Framer(8);
+	const std::string Input = "{\"method\":\"ping\"}\n";
+
+	std::vector<std::string> Frames;
+	for (const char Byte : Input)
+	{
+		const std::span<char> Tail = Framer.PrepareWrite(1);
+		Tail[0] = Byte;
+		Framer.CommitWrite(1);
+		Framer.ConsumeFrames([&Frames](const std::string_view InFrame) { Frames.emplace_back(InFrame); });
+	}
+
+	MCP_CHECK_EQ(Frames.size(), std::size_t{ 1 });
+	MCP_CHECK_EQ(Frames[0], std::string{ "{\"method\":\"ping\"}" });
+}
+
+MCP_TEST(LineFramer_DeliversBinaryFramesBetweenLines)
+{
+	std::string Binary;
+	MCP::BinaryFrame::Write(MCP::JSONData{ { "id", 7 } }, MCP::EWireFormat::CBOR, Binary);
+
+	MCP::LineFramer Framer;
+	Framer.Append("{\"first\":true}\n");
+	Framer.Append(Binary.substr(0, 3));
+	MCP_CHECK_EQ(Drain(Framer).size(), std::size_t{ 1 });
+
+	Framer.Append(Binary.substr(3));
+	Framer.Append("{\"last\":true}\n");
+	const std::vector<std::string> Frames = Drain(Framer);
+	MCP_CHECK_EQ(Frames.size(), std::size_t{ 2 });
+	MCP_CHECK(MCP::BinaryFrame::IsTag(Frames[0].front()));
+	MCP_CHECK_EQ(MCP::BinaryFrame::Read(Frames[0]).at("id").get<int>(), 7);
+	MCP_CHECK_EQ(Frames[1], std::string{ "{\"last\":true}" });
+}
+
+MCP_TEST(LineFramer_DiscardsOversizedLinesAndRecovers)
+{
+	MCP::LineFramer Framer(16, 16);
+	Framer.Append(std::string(40, 'x'));
+	MCP_CHECK(Drain(Framer).empty());
+
+	Framer.Append(std::string(10, 'x') + "\n{\"ok\":1}\n");
+	const std::vector<std::string> Frames = Drain(Framer);
+	MCP_CHECK_EQ(Frames.size(), std::size_t{ 1 });
+	MCP_CHECK_EQ(Frames[0], std::string{ "{\"ok\":1}" });
+}
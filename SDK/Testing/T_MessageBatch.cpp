@@ -0,0 +1,136 @@
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CoreSDK/Core/IMCP.h"
+#include "CoreSDK/Messages/MCPMessages.h"
+#include "CoreSDK/Transport/ITransport.h"
+#include "TestHarness.h"
+
+namespace
+{
+	// Keeps everything the protocol sends, in order
+	class RecordingTransport : public MCP::ITransport
+	{
+	public:
+		struct Sent
+		{
+			MCP::JSONData Message;
+			std::optional<std::vector<MCP::ConnectionID>> ConnectionIDs;
+		};
+
+		MCP::VoidTask Connect() override { co_return; }
+		MCP::VoidTask Disconnect() override { co_return; }
+		void TransmitMessage(const MCP::JSONData& InMessage,
+			const std::optional<std::vector<MCP::ConnectionID>>& InConnectionIDs) override
+		{
+			std::scoped_lock Lock(m_Mutex);
+			m_Sent.push_back({ InMessage, InConnectionIDs });
+		}
+		using ITransport::TransmitMessage;
+		[[nodiscard]] std::string GetConnectionInfo() const override { return "recording"; }
+
+		[[nodiscard]] std::vector<Sent> GetSent() const
+		{
+			std::scoped_lock Lock(m_Mutex);
+			return m_Sent;
+		}
+
+	private:
+		mutable std::mutex m_Mutex;
+		std::vector<Sent> m_Sent;
+	};
+
+	// Answers pings and counts initialized notifications, as a server would
+	class BatchProtocol : public MCP::MCPProtocol
+	{
+	public:
+		explicit BatchProtocol(std::unique_ptr<RecordingTransport> InTransport)
+			: MCPProtocol(std::move(InTransport), true)
+		{
+			m_MessageManager->RegisterRequestHandler<MCP::PingRequest>(
+				[this](const MCP::PingRequest& InRequest)
+				{ SendMCPMessage(MCP::PingResponse{ InRequest.GetRequestID() }); });
+			m_MessageManager->RegisterNotificationHandler<MCP::InitializedNotification>(
+				[this](const MCP::InitializedNotification&) { ++m_Notified; });
+		}
+
+		MCP::VoidTask Start() override { co_return; }
+		MCP::VoidTask Stop() override { co_return; }
+
+		[[nodiscard]] int GetNotified() const { return m_Notified; }
+
+	private:
+		std::atomic<int> m_Notified{ 0 };
+	};
+
+	struct BatchFixture
+	{
+		RecordingTransport* Transport;
+		BatchProtocol Protocol;
+
+		explicit BatchFixture(std::unique_ptr<RecordingTransport> InTransport = std::make_unique<RecordingTransport>())
+			: Transport(InTransport.get()),
+			  Protocol(std::move(InTransport))
+		{}
+
+		void Receive(const std::string& InBatch) const { Transport->CallMessageRouter(InBatch, "session-1"); }
+	};
+} // namespace
+
+MCP_TEST(MessageBatch_AnswersEveryRequestInOneReply)
+{
+	BatchFixture Fixture;
+	Fixture.Receive(R"([{"jsonrpc":"2.0","id":1,"method":"ping"},)"
+					R"({"jsonrpc":"2.0","id":"two","method":"ping"},)"
+					R"({"jsonrpc":"2.0","method":"notifications/initialized"},)"
+					R"({"jsonrpc":"2.0","id":3,"method":"tools/unheard_of"}])");
+
+	const std::vector<RecordingTransport::Sent> Sent = Fixture.Transport->GetSent();
+	MCP_CHECK_EQ(Sent.size(), 1u);
+	MCP_CHECK(Sent[0].ConnectionIDs == std::vector<MCP::ConnectionID>{ "session-1" });
+	MCP_CHECK_EQ(Fixture.Protocol.GetNotified(), 1);
+
+	const MCP::JSONData& Reply = Sent[0].Message;
+	MCP_CHECK(Reply.is_array());
+	MCP_CHECK_EQ(Reply.size(), 3u);
+
+	// Elements are handled concurrently, so replies may come in any order, but each request is answered once
+	const auto CountID = [&Reply](const MCP::JSONData& InID)
+	{
+		int Count = 0;
+		for (const MCP::JSONData& Element : Reply)
+		{
+			Count += Element.value("id", MCP::JSONData{}) == InID ? 1 : 0;
+		}
+		return Count;
+	};
+	MCP_CHECK_EQ(CountID(1), 1);
+	MCP_CHECK_EQ(CountID("two"), 1);
+	MCP_CHECK_EQ(CountID(3), 1);
+
+	for (const MCP::JSONData& Element : Reply)
+	{
+		if (Element.at("id") == 3)
+		{
+			MCP_CHECK_EQ(Element.at("error").at("code").get<int>(), -32601);
+		}
+		else
+		{
+			MCP_CHECK(Element.contains("result"));
+		}
+	}
+}
+
+MCP_TEST(MessageBatch_NotificationsAloneGetNoReply)
+{
+	BatchFixture Fixture;
+	Fixture.Receive(R"([{"jsonrpc":"2.0","method":"notifications/initialized"},)"
+					R"({"jsonrpc":"2.0","method":"notifications/initialized"}])");
+
+	MCP_CHECK_EQ(Fixture.Protocol.GetNotified(), 2);
+	MCP_CHECK(Fixture.Transport->GetSent().empty());
+}
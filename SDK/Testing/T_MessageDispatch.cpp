@@ -0,0 +1,121 @@
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CoreSDK/Messages/MCPMessages.h"
+#include "CoreSDK/Messages/MessageContext.h"
+#include "CoreSDK/Messages/MessageManager.h"
+#include "TestHarness.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	constexpr auto WAIT_LIMIT{ 5s };
+
+	std::string Ping(const std::size_t InID)
+	{
+		return R"({"jsonrpc":"2.0","id":)" + std::to_string(InID) + R"(,"method":"ping"})";
+	}
+
+	std::shared_ptr<MCP::MessageManager> MakeManager(const MCP::MessageDispatchOptions& InOptions)
+	{
+		auto Manager = std::make_shared<MCP::MessageManager>(true);
+		MCP_CHECK(Manager->SetDispatchOptions(InOptions));
+		return Manager;
+	}
+} // namespace
+
+MCP_TEST(MessageDispatch_ConcurrentHandlersRunInParallel)
+{
+	const auto Manager = MakeManager({ .Mode = MCP::EDispatchMode::Concurrent, .WorkerThreads = 2 });
+
+	// Each handler waits for the other to start, which only happens if both run at once
+	std::mutex Mutex;
+	std::condition_variable Changed;
+	int Running = 0;
+	int Overlapped = 0;
+	int Finished = 0;
+	Manager->RegisterRequestHandler<MCP::PingRequest>(
+		[&](const MCP::PingRequest&)
+		{
+			std::unique_lock Lock(Mutex);
+			++Running;
+			Changed.notify_all();
+			if (Changed.wait_for(Lock, WAIT_LIMIT, [&] { return Running == 2; }))
+			{
+				++Overlapped;
+			}
+			++Finished;
+			Changed.notify_all();
+		});
+
+	MCP_CHECK(Manager->RouteMessage(Ping(1)));
+	MCP_CHECK(Manager->RouteMessage(Ping(2)));
+
+	std::unique_lock Lock(Mutex);
+	MCP_CHECK(Changed.wait_for(Lock, WAIT_LIMIT * 2, [&] { return Finished == 2; }));
+	MCP_CHECK_EQ(Overlapped, 2);
+}
+
+MCP_TEST(MessageDispatch_OrderedSessionsKeepArrivalOrder)
+{
+	const auto Manager = MakeManager(
+		{ .Mode = MCP::EDispatchMode::Concurrent, .WorkerThreads = 4, .PreserveSessionOrder = true });
+
+	constexpr std::size_t MESSAGES_PER_SESSION{ 50 };
+	std::mutex Mutex;
+	std::condition_variable Changed;
+	std::vector<std::size_t> FirstSession;
+	std::vector<std::size_t> SecondSession;
+	Manager->RegisterRequestHandler<MCP::PingRequest>(
+		[&](const MCP::PingRequest& InRequest)
+		{
+			const auto ID = static_cast<std::size_t>(std::get<int64_t>(InRequest.GetRequestID().Value));
+			// Early messages take longest, so any handler allowed to overtake another would
+			std::this_thread::sleep_for(std::chrono::microseconds{ (MESSAGES_PER_SESSION - ID % 1000) * 20 });
+
+			std::scoped_lock Lock(Mutex);
+			(MCP::MessageContext::GetConnectionID() == "first" ? FirstSession : SecondSession).push_back(ID);
+			Changed.notify_all();
+		});
+
+	for (std::size_t Index = 0; Index < MESSAGES_PER_SESSION; ++Index)
+	{
+		MCP_CHECK(Manager->RouteMessage(Ping(Index), "first"));
+		MCP_CHECK(Manager->RouteMessage(Ping(1000 + Index), "second"));
+	}
+
+	std::unique_lock Lock(Mutex);
+	MCP_CHECK(Changed.wait_for(Lock,
+		WAIT_LIMIT,
+		[&]
+		{
+			return FirstSession.size() == MESSAGES_PER_SESSION && SecondSession.size() == MESSAGES_PER_SESSION;
+		}));
+	for (std::size_t Index = 0; Index < MESSAGES_PER_SESSION; ++Index)
+	{
+		MCP_CHECK_EQ(FirstSession[Index], Index);
+		MCP_CHECK_EQ(SecondSession[Index], 1000 + Index);
+	}
+}
+
+MCP_TEST(MessageDispatch_OptionsAreFixedOnceRoutingStarts)
+{
+	const auto Manager = std::make_shared<MCP::MessageManager>(true);
+	MCP_CHECK(Manager->SetDispatchOptions({ .Mode = MCP::EDispatchMode::Concurrent }));
+	MCP_CHECK(Manager->SetDispatchOptions({ .Mode = MCP::EDispatchMode::Inline }));
+
+	Manager->RegisterRequestHandler<MCP::PingRequest>([](const MCP::PingRequest&) {});
+	MCP_CHECK(Manager->RouteMessage(Ping(1)));
+
+	MCP_CHECK(!Manager->SetDispatchOptions({ .Mode = MCP::EDispatchMode::Concurrent, .WorkerThreads = 2 }));
+	MCP_CHECK(Manager->GetDispatchOptions().Mode == MCP::EDispatchMode::Inline);
+	MCP_CHECK_EQ(Manager->GetDispatchOptions().WorkerThreads, 0u);
+}
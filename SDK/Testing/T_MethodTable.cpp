@@ -0,0 +1,30 @@
+#include <cstddef>
+#include <string>
+
+#include "CoreSDK/Messages/MethodTable.h"
+#include "TestHarness.h"
+
+MCP_TEST(MethodTable_FindsEverySpecMethod)
+{
+	for (std::size_t Index = 0; Index < MCP::MCP_METHOD_COUNT; ++Index)
+	{
+		const auto Method = static_cast<MCP::EMCPMethod>(Index);
+		const std::optional<MCP::EMCPMethod> Found = MCP::FindMCPMethod(MCP::ToString(Method));
+		MCP_CHECK(Found.has_value());
+		MCP_CHECK(*Found == Method);
+	}
+}
+
+MCP_TEST(MethodTable_RejectsNamesOutsideTheSpec)
+{
+	MCP_CHECK(!MCP::FindMCPMethod("").has_value());
+	MCP_CHECK(!MCP::FindMCPMethod("Ping").has_value());
+	MCP_CHECK(!MCP::FindMCPMethod("ping ").has_value());
+	MCP_CHECK(!MCP::FindMCPMethod("tools/lis").has_value());
+	MCP_CHECK(!MCP::FindMCPMethod("custom/method").has_value());
+
+	// Same length and prefix as a spec method, so only the final compare can reject it
+	std::string Name{ MCP::ToString(MCP::EMCPMethod::ListTools) };
+	Name.back() = 'x';
+	MCP_CHECK(!MCP::FindMCPMethod(Name).has_value());
+}
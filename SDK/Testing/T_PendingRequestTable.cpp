@@ -0,0 +1,79 @@
+#include <cstdint>
+#include <map>
+#include <random>
+
+#include "CoreSDK/Messages/PendingRequestTable.h"
+#include "TestHarness.h"
+
+MCP_TEST(PendingRequestTable_InsertTakeRemove)
+{
+	MCP::PendingRequestTable<int> Table(4);
+	MCP_CHECK(Table.IsEmpty());
+	MCP_CHECK(Table.Insert(1, 10));
+	MCP_CHECK(Table.Insert(2, 20));
+	MCP_CHECK(!Table.Insert(1, 11));
+	MCP_CHECK_EQ(Table.Size(), std::size_t{ 2 });
+
+	MCP_CHECK(Table.Contains(2));
+	MCP_CHECK_EQ(Table.Take(1).value_or(0), 10);
+	MCP_CHECK(!Table.Take(1).has_value());
+	MCP_CHECK(Table.Remove(2));
+	MCP_CHECK(!Table.Remove(2));
+	MCP_CHECK(Table.IsEmpty());
+}
+
+MCP_TEST(PendingRequestTable_GrowsPastItsInitialCapacity)
+{
+	MCP::PendingRequestTable<int64_t> Table(2);
+	for (int64_t ID = 1; ID <= 1000; ++ID)
+	{
+		MCP_CHECK(Table.Insert(ID, ID * 3));
+	}
+	MCP_CHECK_EQ(Table.Size(), std::size_t{ 1000 });
+	for (int64_t ID = 1; ID <= 1000; ++ID)
+	{
+		MCP_CHECK_EQ(Table.Take(ID).value_or(-1), ID * 3);
+	}
+	MCP_CHECK(Table.IsEmpty());
+}
+
+// Colliding IDs share probe runs, so removals in the middle of a run must keep the entries after it reachable
+MCP_TEST(PendingRequestTable_MatchesAMapUnderRandomChurn)
+{
+	MCP::PendingRequestTable<int64_t> Table(8);
+	std::map<int64_t, int64_t> Expected;
+	std::mt19937_64 Random(12345);
+
+	for (int Step = 0; Step < 20000; ++Step)
+	{
+		// A small key space keyed by multiples of the capacity forces long probe runs
+		const int64_t ID = static_cast<int64_t>(Random() % 64) * 16;
+		switch (Random() % 3)
+		{
+			case 0:
+				MCP_CHECK_EQ(Table.Insert(ID, Step), Expected.try_emplace(ID, Step).second);
+				break;
+			case 1:
+				MCP_CHECK_EQ(Table.Remove(ID), Expected.erase(ID) > 0);
+				break;
+			default:
+			{
+				const auto Iter = Expected.find(ID);
+				const std::optional<int64_t> Taken = Table.Take(ID);
+				MCP_CHECK_EQ(Taken.has_value(), Iter != Expected.end());
+				if (Iter != Expected.end())
+				{
+					MCP_CHECK_EQ(*Taken, Iter->second);
+					Expected.erase(Iter);
+				}
+				break;
+			}
+		}
+		MCP_CHECK_EQ(Table.Size(), Expected.size());
+	}
+
+	for (const auto& [ID, Value] : Expected)
+	{
+		MCP_CHECK(Table.Contains(ID));
+	}
+}
@@ -0,0 +1,147 @@
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "TestHarness.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/Async/Task.h"
+#include "Utilities/Async/TaskCombinators.h"
+#include "Utilities/Async/TimerWheel.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	MCP::Task<int> Value(const int InValue) { co_return InValue; }
+
+	MCP::Task<int> Delayed(MCP::TimerWheel& InWheel, const std::chrono::milliseconds InDelay, const int InValue)
+	{
+		co_await InWheel.Sleep(InDelay);
+		co_return InValue;
+	}
+
+	MCP::Task<int> Throws()
+	{
+		throw std::runtime_error("element failed");
+		co_return 0;
+	}
+
+	MCP::Task<std::tuple<int, int, int>> AllOfThree(MCP::TimerWheel& InWheel)
+	{
+		MCP::Task<int> First = Delayed(InWheel, 30ms, 1);
+		MCP::Task<int> Second = Value(2);
+		MCP::Task<int> Third = Delayed(InWheel, 10ms, 3);
+		co_return co_await MCP::WhenAll(First, Second, Third);
+	}
+
+	MCP::Task<std::vector<int>> AllOfMany(MCP::TimerWheel& InWheel)
+	{
+		std::vector<MCP::Task<int>> Tasks;
+		for (int Index = 0; Index < 16; ++Index)
+		{
+			Tasks.push_back(Delayed(InWheel, std::chrono::milliseconds{ (16 - Index) * 2 }, Index));
+		}
+		co_return co_await MCP::WhenAll(Tasks);
+	}
+
+	MCP::Task<bool> AwaitsMovedFrom()
+	{
+		MCP::Task<int> Original = Value(1);
+		MCP::Task<int> Taken = std::move(Original);
+		bool IsRejected = false;
+		try
+		{
+			(void)co_await Original;
+		}
+		catch (const std::logic_error&)
+		{
+			IsRejected = true;
+		}
+		co_return IsRejected && co_await Taken == 1;
+	}
+
+	MCP::Task<bool> AllRethrows()
+	{
+		MCP::Task<int> Good = Value(1);
+		MCP::Task<int> Bad = Throws();
+		try
+		{
+			(void)co_await MCP::WhenAll(Good, Bad);
+		}
+		catch (const std::runtime_error&)
+		{
+			co_return true;
+		}
+		co_return false;
+	}
+
+	MCP::Task<std::size_t> AnyPicksTheFirst(MCP::TimerWheel& InWheel)
+	{
+		// The sleep can be cancelled, so WhenAny does not wait the full second for it
+		MCP::TimerWheel::SleepAwaiter Slow = InWheel.Sleep(1s);
+		MCP::Task<int> Fast = Delayed(InWheel, 10ms, 7);
+		auto Winner = co_await MCP::WhenAny(Slow, Fast);
+		if (Winner.index() == 1 && std::get<1>(Winner) != 7)
+		{
+			co_return 99;
+		}
+		co_return Winner.index();
+	}
+
+	MCP::Task<std::optional<int>> ValueWithin(MCP::TimerWheel& InWheel, const std::chrono::milliseconds InTimeout)
+	{
+		MCP::Task<int> Quick = Delayed(InWheel, 10ms, 5);
+		co_return co_await MCP::WithTimeout(Quick, InTimeout, InWheel);
+	}
+
+	MCP::Task<bool> SleepWithin(MCP::TimerWheel& InWheel, const std::chrono::milliseconds InTimeout)
+	{
+		MCP::TimerWheel::SleepAwaiter Slow = InWheel.Sleep(1s);
+		const auto Result = co_await MCP::WithTimeout(Slow, InTimeout, InWheel);
+		co_return Result.has_value();
+	}
+} // namespace
+
+MCP_TEST(TaskCombinators_WhenAllReturnsEveryResultInOrder)
+{
+	MCP::TimerWheel Wheel(1ms);
+	const auto [First, Second, Third] = MCP::SyncWait(AllOfThree(Wheel));
+	MCP_CHECK_EQ(First, 1);
+	MCP_CHECK_EQ(Second, 2);
+	MCP_CHECK_EQ(Third, 3);
+
+	const std::vector<int> Many = MCP::SyncWait(AllOfMany(Wheel));
+	MCP_CHECK_EQ(Many.size(), std::size_t{ 16 });
+	for (int Index = 0; Index < 16; ++Index)
+	{
+		MCP_CHECK_EQ(Many[static_cast<std::size_t>(Index)], Index);
+	}
+}
+
+MCP_TEST(TaskCombinators_WhenAllRethrowsAnElementsException) { MCP_CHECK(MCP::SyncWait(AllRethrows())); }
+
+MCP_TEST(TaskCombinators_AwaitingAMovedFromTaskThrows) { MCP_CHECK(MCP::SyncWait(AwaitsMovedFrom())); }
+
+MCP_TEST(TaskCombinators_WhenAnyReturnsTheFirstToFinish)
+{
+	MCP::TimerWheel Wheel(1ms);
+	const auto Start = std::chrono::steady_clock::now();
+	MCP_CHECK_EQ(MCP::SyncWait(AnyPicksTheFirst(Wheel)), std::size_t{ 1 });
+	MCP_CHECK(std::chrono::steady_clock::now() - Start < 500ms);
+	MCP_CHECK_EQ(Wheel.GetPendingCount(), std::size_t{ 0 });
+}
+
+MCP_TEST(TaskCombinators_WithTimeoutReturnsTheValueOrNothing)
+{
+	MCP::TimerWheel Wheel(1ms);
+	MCP_CHECK_EQ(MCP::SyncWait(ValueWithin(Wheel, 1s)).value_or(-1), 5);
+
+	const auto Start = std::chrono::steady_clock::now();
+	MCP_CHECK(!MCP::SyncWait(SleepWithin(Wheel, 20ms)));
+	MCP_CHECK(std::chrono::steady_clock::now() - Start < 500ms);
+	MCP_CHECK_EQ(Wheel.GetPendingCount(), std::size_t{ 0 });
+}
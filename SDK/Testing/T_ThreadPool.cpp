@@ -0,0 +1,135 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "TestHarness.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/Async/Task.h"
+#include "Utilities/Async/ThreadPool.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	MCP::Task<bool> RunOnPool(MCP::ThreadPool& InPool)
+	{
+		co_await InPool.Schedule();
+		co_return InPool.IsWorkerThread();
+	}
+} // namespace
+
+MCP_TEST(ThreadPool_RunsEveryPostedJob)
+{
+	constexpr int JOB_COUNT{ 10000 };
+
+	std::atomic<int> Completed{ 0 };
+	std::mutex Mutex;
+	std::condition_variable Done;
+	{
+		MCP::ThreadPool Pool(4);
+		MCP_CHECK_EQ(Pool.GetThreadCount(), std::size_t{ 4 });
+		MCP_CHECK(!Pool.IsWorkerThread());
+
+		for (int Index = 0; Index < JOB_COUNT; ++Index)
+		{
+			Pool.Post(
+				[&]
+				{
+					if (Completed.fetch_add(1) + 1 == JOB_COUNT)
+					{
+						std::scoped_lock Lock(Mutex);
+						Done.notify_all();
+					}
+				});
+		}
+
+		std::unique_lock Lock(Mutex);
+		MCP_CHECK(Done.wait_for(Lock, 10s, [&] { return Completed.load() == JOB_COUNT; }));
+	}
+	MCP_CHECK_EQ(Completed.load(), JOB_COUNT);
+}
+
+// Destroying the pool runs what is still queued, including the jobs those post, rather than dropping it
+MCP_TEST(ThreadPool_DestructorRunsQueuedJobs)
+{
+	constexpr int JOB_COUNT{ 100 };
+
+	std::atomic<int> Completed{ 0 };
+	{
+		MCP::ThreadPool Pool(2);
+		for (int Index = 0; Index < JOB_COUNT; ++Index)
+		{
+			Pool.Post(
+				[&]
+				{
+					std::this_thread::sleep_for(1ms);
+					Pool.Post([&Completed] { Completed.fetch_add(1); });
+				});
+		}
+	}
+	MCP_CHECK_EQ(Completed.load(), JOB_COUNT);
+}
+
+// Jobs posted from a worker go to its own queue; idle workers have to steal them for all of them to run in parallel
+MCP_TEST(ThreadPool_IdleWorkersStealFromABusyOne)
+{
+	MCP::ThreadPool Pool(4);
+	std::atomic<int> Running{ 0 };
+	std::atomic<int> MaxRunning{ 0 };
+	std::atomic<int> Completed{ 0 };
+
+	Pool.Post(
+		[&]
+		{
+			for (int Index = 0; Index < 4; ++Index)
+			{
+				Pool.Post(
+					[&]
+					{
+						const int Now = Running.fetch_add(1) + 1;
+						int Seen = MaxRunning.load();
+						while (Now > Seen && !MaxRunning.compare_exchange_weak(Seen, Now))
+						{
+						}
+						std::this_thread::sleep_for(50ms);
+						Running.fetch_sub(1);
+						Completed.fetch_add(1);
+					});
+			}
+		});
+
+	const auto Deadline = std::chrono::steady_clock::now() + 10s;
+	while (Completed.load() < 4 && std::chrono::steady_clock::now() < Deadline)
+	{
+		std::this_thread::sleep_for(5ms);
+	}
+	MCP_CHECK_EQ(Completed.load(), 4);
+	MCP_CHECK(MaxRunning.load() > 1);
+}
+
+MCP_TEST(ThreadPool_ParallelForCoversEveryIndexOnce)
+{
+	MCP::ThreadPool Pool(3);
+	std::vector<std::atomic<int>> Visits(1000);
+	Pool.ParallelFor(Visits.size(), [&Visits](const std::size_t InIndex) { Visits[InIndex].fetch_add(1); });
+	for (const std::atomic<int>& Count : Visits)
+	{
+		MCP_CHECK_EQ(Count.load(), 1);
+	}
+
+	// Nested from a worker, where the caller has to help for it to finish at all
+	std::atomic<int> Inner{ 0 };
+	Pool.ParallelFor(3,
+		[&Pool, &Inner](std::size_t)
+		{ Pool.ParallelFor(100, [&Inner](std::size_t) { Inner.fetch_add(1); }); });
+	MCP_CHECK_EQ(Inner.load(), 300);
+}
+
+MCP_TEST(ThreadPool_ScheduleMovesTheCoroutineOntoAWorker)
+{
+	MCP::ThreadPool Pool(2);
+	MCP_CHECK(MCP::SyncWait(RunOnPool(Pool)));
+}
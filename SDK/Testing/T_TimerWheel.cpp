@@ -0,0 +1,104 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "TestHarness.h"
+#include "Utilities/Async/SyncWait.h"
+#include "Utilities/Async/Task.h"
+#include "Utilities/Async/TimerWheel.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	// Collects the order timers fired in and lets the test wait for a number of them
+	struct FiredLog
+	{
+		std::mutex Mutex;
+		std::condition_variable Changed;
+		std::vector<int> Order;
+
+		void Add(const int InValue)
+		{
+			std::scoped_lock Lock(Mutex);
+			Order.push_back(InValue);
+			Changed.notify_all();
+		}
+
+		bool WaitFor(const std::size_t InCount, const std::chrono::milliseconds InTimeout)
+		{
+			std::unique_lock Lock(Mutex);
+			return Changed.wait_for(Lock, InTimeout, [this, InCount] { return Order.size() >= InCount; });
+		}
+	};
+
+	MCP::Task<int> SleepThenReturn(MCP::TimerWheel& InWheel, const int InValue)
+	{
+		co_await InWheel.Sleep(20ms);
+		co_return InValue;
+	}
+} // namespace
+
+MCP_TEST(TimerWheel_FiresInOrderAndNeverEarly)
+{
+	MCP::TimerWheel Wheel(5ms);
+	FiredLog Log;
+
+	const auto Start = std::chrono::steady_clock::now();
+	std::atomic<long long> FirstElapsedMs{ 0 };
+	Wheel.Schedule(60ms, [&Log] { Log.Add(3); });
+	Wheel.Schedule(20ms,
+		[&Log, &FirstElapsedMs, Start]
+		{
+			FirstElapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::steady_clock::now() - Start)
+								 .count();
+			Log.Add(1);
+		});
+	Wheel.Schedule(40ms, [&Log] { Log.Add(2); });
+	MCP_CHECK_EQ(Wheel.GetPendingCount(), std::size_t{ 3 });
+
+	MCP_CHECK(Log.WaitFor(3, 5s));
+	MCP_CHECK(Log.Order == (std::vector<int>{ 1, 2, 3 }));
+	MCP_CHECK(FirstElapsedMs.load() >= 20);
+	MCP_CHECK_EQ(Wheel.GetPendingCount(), std::size_t{ 0 });
+}
+
+MCP_TEST(TimerWheel_CancelledTimersDoNotFire)
+{
+	MCP::TimerWheel Wheel(5ms);
+	FiredLog Log;
+
+	const MCP::TimerWheel::TimerID Cancelled = Wheel.Schedule(20ms, [&Log] { Log.Add(1); });
+	Wheel.Schedule(40ms, [&Log] { Log.Add(2); });
+	MCP_CHECK(Wheel.Cancel(Cancelled));
+	MCP_CHECK(!Wheel.Cancel(Cancelled));
+	MCP_CHECK(!Wheel.Cancel(MCP::TimerWheel::INVALID_TIMER));
+
+	MCP_CHECK(Log.WaitFor(1, 5s));
+	std::this_thread::sleep_for(30ms);
+	MCP_CHECK(Log.Order == (std::vector<int>{ 2 }));
+}
+
+// Far enough out to sit in an upper level and be cascaded down before it fires
+MCP_TEST(TimerWheel_CascadesTimersFromUpperLevels)
+{
+	MCP::TimerWheel Wheel(1ms);
+	FiredLog Log;
+
+	const auto Start = std::chrono::steady_clock::now();
+	Wheel.Schedule(150ms, [&Log] { Log.Add(1); });
+	MCP_CHECK(Log.WaitFor(1, 5s));
+	MCP_CHECK(std::chrono::steady_clock::now() - Start >= 150ms);
+}
+
+MCP_TEST(TimerWheel_SleepResumesTheCoroutine)
+{
+	MCP::TimerWheel Wheel(5ms);
+	const auto Start = std::chrono::steady_clock::now();
+	MCP_CHECK_EQ(MCP::SyncWait(SleepThenReturn(Wheel, 42)), 42);
+	MCP_CHECK(std::chrono::steady_clock::now() - Start >= 20ms);
+}
@@ -0,0 +1,48 @@
+#include <string>
+
+#include "CoreSDK/Features/ToolManager.h"
+#include "TestHarness.h"
+
+namespace
+{
+	MCP::Tool MakeTool(const std::string& InName)
+	{
+		MCP::Tool Result;
+		Result.Name = InName;
+		Result.InputSchema.Type = "object";
+		return Result;
+	}
+
+	MCP::CallToolResponse::Result NoResult(const MCP::JSONData&, MCPContext*) { return {}; }
+} // namespace
+
+MCP_TEST(ToolManager_SharesTheSerializedListBetweenReads)
+{
+	MCP::ToolManager Tools;
+	MCP_CHECK(Tools.AddTool(MakeTool("search"), NoResult));
+
+	const MCP::SerializedCache::Text First = Tools.GetSerializedToolList();
+	const MCP::SerializedCache::Text Second = Tools.GetSerializedToolList();
+	MCP_CHECK(First != nullptr);
+	MCP_CHECK(First == Second);
+	MCP_CHECK(First->find("\"search\"") != std::string::npos);
+}
+
+MCP_TEST(ToolManager_AddingOrRemovingAToolRebuildsTheSerializedList)
+{
+	MCP::ToolManager Tools;
+	MCP_CHECK(Tools.AddTool(MakeTool("search"), NoResult));
+	const MCP::SerializedCache::Text BeforeAdd = Tools.GetSerializedToolList();
+
+	MCP_CHECK(Tools.AddTool(MakeTool("fetch"), NoResult));
+	const MCP::SerializedCache::Text AfterAdd = Tools.GetSerializedToolList();
+	MCP_CHECK(AfterAdd != BeforeAdd);
+	MCP_CHECK(BeforeAdd->find("\"fetch\"") == std::string::npos);
+	MCP_CHECK(AfterAdd->find("\"fetch\"") != std::string::npos);
+
+	MCP_CHECK(Tools.RemoveTool(MakeTool("search")));
+	const MCP::SerializedCache::Text AfterRemove = Tools.GetSerializedToolList();
+	MCP_CHECK(AfterRemove != AfterAdd);
+	MCP_CHECK(AfterRemove->find("\"search\"") == std::string::npos);
+	MCP_CHECK(AfterRemove->find("\"fetch\"") != std::string::npos);
+}
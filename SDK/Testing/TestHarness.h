@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal self-registering test harness for sdk_tests, so the suite builds with nothing beyond the SDK's own
+ * dependencies. Each MCP_TEST body runs in turn; a failed check throws out of its test and the run carries on with
+ * the next one. Passing a name filter on the command line runs only the tests whose name contains it.
+ */
+namespace MCPTest
+{
+	using TestBody = void (*)();
+
+	struct TestCase
+	{
+		const char* Name;
+		TestBody Body;
+	};
+
+	inline std::vector<TestCase>& GetRegistry()
+	{
+		static std::vector<TestCase> Registry;
+		return Registry;
+	}
+
+	struct Registrar
+	{
+		Registrar(const char* InName, const TestBody InBody) { GetRegistry().push_back(TestCase{ InName, InBody }); }
+	};
+
+	class CheckFailure : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+	[[noreturn]] inline void Fail(const char* InFile, const int InLine, const std::string& InMessage)
+	{
+		std::ostringstream Stream;
+		Stream << InFile << ":" << InLine << ": " << InMessage;
+		throw CheckFailure(Stream.str());
+	}
+
+	template <typename TLeft, typename TRight>
+	void CheckEqual(const TLeft& InLeft,
+		const TRight& InRight,
+		const char* InExpression,
+		const char* InFile,
+		const int InLine)
+	{
+		if (InLeft == InRight)
+		{
+			return;
+		}
+		std::ostringstream Stream;
+		Stream << "expected " << InExpression << ", got " << InLeft << " and " << InRight;
+		Fail(InFile, InLine, Stream.str());
+	}
+} // namespace MCPTest
+
+#define MCP_TEST_CONCAT_INNER(A, B) A##B
+#define MCP_TEST_CONCAT(A, B) MCP_TEST_CONCAT_INNER(A, B)
+
+#define MCP_TEST(Name)                                                                                                 \
+	static void Name();                                                                                                \
+	static const MCPTest::Registrar MCP_TEST_CONCAT(Name, _Registrar){ #Name, &Name };                               \
+	static void Name()
+
+#define MCP_CHECK(Expression)                                                                                          \
+	do                                                                                                                 \
+	{                                                                                                                  \
+		if (!(Expression))                                                                                             \
+		{                                                                                                              \
+			MCPTest::Fail(__FILE__, __LINE__, "check failed: " #Expression);                                           \
+		}                                                                                                              \
+	}                                                                                                                  \
+	while (false)
+
+#define MCP_CHECK_EQ(Left, Right) MCPTest::CheckEqual((Left), (Right), #Left " == " #Right, __FILE__, __LINE__)
+
+#define MCP_CHECK_THROWS(Expression, ExceptionType)                                                                    \
+	do                                                                                                                 \
+	{                                                                                                                  \
+		bool HasThrown = false;                                                                                        \
+		try                                                                                                            \
+		{                                                                                                              \
+			(void)(Expression);                                                                                        \
+		}                                                                                                              \
+		catch (const ExceptionType&)                                                                                   \
+		{                                                                                                              \
+			HasThrown = true;                                                                                          \
+		}                                                                                                              \
+		if (!HasThrown)                                                                                                \
+		{                                                                                                              \
+			MCPTest::Fail(__FILE__, __LINE__, "expected " #Expression " to throw " #ExceptionType);                    \
+		}                                                                                                              \
+	}                                                                                                                  \
+	while (false)
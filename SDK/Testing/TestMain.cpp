@@ -0,0 +1,35 @@
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#include "TestHarness.h"
+
+int main(const int argc, char** argv)
+{
+	const char* Filter = argc > 1 ? argv[1] : nullptr;
+
+	std::size_t Passed{ 0 };
+	std::size_t Failed{ 0 };
+	for (const MCPTest::TestCase& Test : MCPTest::GetRegistry())
+	{
+		if (Filter != nullptr && std::strstr(Test.Name, Filter) == nullptr)
+		{
+			continue;
+		}
+
+		try
+		{
+			Test.Body();
+			++Passed;
+			std::cout << "[ PASS ] " << Test.Name << std::endl;
+		}
+		catch (const std::exception& Except)
+		{
+			++Failed;
+			std::cout << "[ FAIL ] " << Test.Name << ": " << Except.what() << std::endl;
+		}
+	}
+
+	std::cout << Passed << " passed, " << Failed << " failed" << std::endl;
+	return Failed == 0 ? 0 : 1;
+}